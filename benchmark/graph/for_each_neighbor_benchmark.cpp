@@ -0,0 +1,138 @@
+/**
+ * Compare the algorithms templated on the graph type called on a concrete
+ * graph, where 'for_each_neighbor' is inlined, and on an 'AbstractGraph',
+ * where it goes through the virtual methods.
+ *
+ * Usage:
+ * OptimizationTools_graph_benchmark [number_of_vertices [number_of_edges [number_of_runs]]]
+ */
+
+#include "optimizationtools/graph/traversal.hpp"
+#include "optimizationtools/graph/adjacency_list_graph.hpp"
+#include "optimizationtools/graph/clique_graph.hpp"
+#include "optimizationtools/graph/clique.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+
+using namespace optimizationtools;
+
+namespace
+{
+
+/** Run a function several times and return the elapsed time in seconds. */
+template <typename Function>
+double measure(
+        int number_of_runs,
+        const Function& function)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int run = 0; run < number_of_runs; ++run)
+        function();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(end - start).count();
+}
+
+void print(
+        const std::string& name,
+        double time_static,
+        double time_virtual)
+{
+    std::cout
+        << std::setw(40) << std::left << name
+        << std::setw(12) << std::right << time_static
+        << std::setw(12) << std::right << time_virtual
+        << std::endl;
+}
+
+/** Benchmark a graph type against the same graph through 'AbstractGraph'. */
+template <typename Graph>
+void benchmark_graph(
+        const std::string& name,
+        const Graph& graph,
+        int number_of_runs)
+{
+    const AbstractGraph& abstract_graph = graph;
+    VertexId number_of_vertices = graph.number_of_vertices();
+
+    VertexId checksum = 0;
+    double time_static = measure(
+            number_of_runs,
+            [&graph, &checksum, number_of_vertices]()
+            {
+                checksum += breadth_first_search(graph, 0).order.size();
+                checksum += depth_first_search(graph, number_of_vertices - 1).size();
+            });
+    double time_virtual = measure(
+            number_of_runs,
+            [&abstract_graph, &checksum, number_of_vertices]()
+            {
+                checksum += breadth_first_search(abstract_graph, 0).order.size();
+                checksum += depth_first_search(abstract_graph, number_of_vertices - 1).size();
+            });
+    print(name + " BFS + DFS", time_static, time_virtual);
+
+    time_static = measure(
+            number_of_runs,
+            [&graph, &checksum]()
+            {
+                checksum += vertex_clique_partition_1(graph).size();
+            });
+    time_virtual = measure(
+            number_of_runs,
+            [&abstract_graph, &checksum]()
+            {
+                checksum += vertex_clique_partition_1(abstract_graph).size();
+            });
+    print(name + " vertex_clique_partition_1", time_static, time_virtual);
+
+    // Keep the results alive.
+    if (checksum == -1)
+        std::cout << checksum << std::endl;
+}
+
+}
+
+int main(int argc, char *argv[])
+{
+    VertexId number_of_vertices = (argc > 1)? std::stoll(argv[1]): 200000;
+    EdgeId number_of_edges = (argc > 2)? std::stoll(argv[2]): 2000000;
+    int number_of_runs = (argc > 3)? std::stoi(argv[3]): 5;
+
+    // Random graph, and the same graph as a clique graph with one clique per
+    // edge.
+    std::mt19937_64 generator(0);
+    std::uniform_int_distribution<VertexId> distribution(0, number_of_vertices - 1);
+    AdjacencyListGraphBuilder graph_builder;
+    CliqueGraphBuilder clique_graph_builder;
+    for (VertexId vertex_id = 0; vertex_id < number_of_vertices; ++vertex_id) {
+        graph_builder.add_vertex();
+        clique_graph_builder.add_vertex();
+    }
+    for (EdgeId edge_id = 0; edge_id < number_of_edges; ++edge_id) {
+        VertexId vertex_1_id = distribution(generator);
+        VertexId vertex_2_id = distribution(generator);
+        if (vertex_1_id == vertex_2_id)
+            continue;
+        graph_builder.add_edge(vertex_1_id, vertex_2_id);
+        clique_graph_builder.add_clique({vertex_1_id, vertex_2_id});
+    }
+    AdjacencyListGraph graph = graph_builder.build();
+    CliqueGraph clique_graph = clique_graph_builder.build();
+
+    std::cout
+        << "Number of vertices: " << number_of_vertices << std::endl
+        << "Number of edges:    " << number_of_edges << std::endl
+        << "Number of runs:     " << number_of_runs << std::endl
+        << std::endl
+        << std::setw(40) << std::left << "Time (s)"
+        << std::setw(12) << std::right << "Static"
+        << std::setw(12) << std::right << "Virtual"
+        << std::endl;
+    benchmark_graph("AdjacencyListGraph", graph, number_of_runs);
+    benchmark_graph("CliqueGraph", clique_graph, number_of_runs);
+    return 0;
+}
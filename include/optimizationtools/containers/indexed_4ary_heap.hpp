@@ -6,6 +6,7 @@
 #include <cstdint>
 #include <functional>
 #include <cassert>
+#include <algorithm>
 
 namespace optimizationtools
 {
@@ -100,62 +101,51 @@ void Indexed4aryHeap<Key>::add_element()
 template <typename Key>
 void Indexed4aryHeap<Key>::percolate_up(Position position)
 {
-    while (position != 0 && cost(position) < cost((position - 1) / 4)) {
-        Position position_child = (position - 1) / 4;
-        positions_[heap_[position].first] = position_child;
-        positions_[heap_[position_child].first] = position;
-        auto tmp = heap_[position_child];
-        heap_[position_child] = heap_[position];
-        heap_[position] = tmp;
-        position = position_child;
+    // The element is moved up through a hole: each parent moved down is
+    // written once, and the element is written at its final position.
+    std::pair<Index, Key> element = heap_[position];
+    while (position != 0) {
+        Position position_parent = (position - 1) / 4;
+        if (!(element.second < cost(position_parent)))
+            break;
+        heap_[position] = heap_[position_parent];
+        positions_[heap_[position].first] = position;
+        position = position_parent;
     }
+    heap_[position] = element;
+    positions_[element.first] = position;
 }
 
 template <typename Key>
 void Indexed4aryHeap<Key>::percolate_down(Position position)
 {
+    // The element is moved down through a hole, as in 'percolate_up'.
+    std::pair<Index, Key> element = heap_[position];
+    Position size = heap_.size();
     for (;;) {
         Position position_child_1 = 4 * position + 1;
-        if (position_child_1 >= heap_.size())
+        if (position_child_1 >= size)
             break;
-        Position position_child_best = position;
-        Key cost_best = cost(position);
-
-        if (cost_best > cost(position_child_1)) {
-            cost_best = cost(position_child_1);
-            position_child_best = position_child_1;
+        Position position_child_best = position_child_1;
+        Key cost_best = cost(position_child_1);
+        Position position_child_end = (std::min)(position_child_1 + 4, size);
+        for (Position position_child = position_child_1 + 1;
+                position_child < position_child_end;
+                ++position_child) {
+            if (cost_best > cost(position_child)) {
+                cost_best = cost(position_child);
+                position_child_best = position_child;
+            }
         }
 
-        Position position_child_2 = 4 * position + 2;
-        if (position_child_2 < heap_.size()
-                && cost_best > cost(position_child_2)) {
-            cost_best = cost(position_child_2);
-            position_child_best = position_child_2;
-        }
-
-        Position position_child_3 = 4 * position + 3;
-        if (position_child_3 < heap_.size()
-                && cost_best > cost(position_child_3)) {
-            cost_best = cost(position_child_3);
-            position_child_best = position_child_3;
-        }
-
-        Position position_child_4 = 4 * position + 4;
-        if (position_child_4 < heap_.size()
-                && cost_best > cost(position_child_4)) {
-            cost_best = cost(position_child_4);
-            position_child_best = position_child_4;
-        }
-
-        if (position_child_best == position)
-            return;
-        positions_[heap_[position].first] = position_child_best;
-        positions_[heap_[position_child_best].first] = position;
-        auto tmp = heap_[position_child_best];
-        heap_[position_child_best] = heap_[position];
-        heap_[position] = tmp;
+        if (!(element.second > cost_best))
+            break;
+        heap_[position] = heap_[position_child_best];
+        positions_[heap_[position].first] = position;
         position = position_child_best;
     }
+    heap_[position] = element;
+    positions_[element.first] = position;
 }
 
 template <typename Key>
@@ -1,8 +1,11 @@
 #pragma once
 
+#include "optimizationtools/utils/bits.hpp"
+
 #include <vector>
 #include <cstdint>
 #include <algorithm>
+#include <functional>
 #include <random>
 #include <cassert>
 #include <iostream>
@@ -18,111 +21,420 @@ struct Element
 {
     ElementId id;
     Cost cost;
-    Position interval_start;
-    Position interval_end;
 };
 
+/**
+ * Array for which it is possible to request the element at a given position
+ * of the sorted array without sorting the whole array.
+ *
+ * The array is partitioned into consecutive intervals such that all the
+ * elements of an interval are not greater than all the elements of the next
+ * interval. The positions where an interval starts ("boundaries") are stored
+ * in a bitset separated from the elements. A query only partitions the
+ * interval containing the requested position (quickselect with a fall back to
+ * 'std::nth_element' if the number of partition steps becomes too large) and
+ * the boundaries found are kept for the next queries.
+ *
+ * The cost of an element can be modified at any time. The element is then
+ * moved across the neighboring intervals until the order between the
+ * intervals is restored, so that the partitioning already done remains valid.
+ */
 class SortedOnDemandArray
 {
 
 public:
 
+    /*
+     * Constructors and destructor
+     */
+
     SortedOnDemandArray() { }
     virtual ~SortedOnDemandArray() { }
 
-    void reset(ElementId number_of_elements);
+    /** Reset the array with 'number_of_elements' elements of cost '0'. */
+    inline void reset(ElementId number_of_elements);
+
+    /*
+     * Getters
+     */
+
+    /** Get the number of elements. */
+    inline ElementId number_of_elements() const { return elements_.size(); }
+
+    /**
+     * Get the id of the element at a given position of the sorted array.
+     */
+    inline ElementId get(
+            Position position,
+            std::mt19937_64& generator);
 
-    void set_cost(ElementId id, Cost cost) { elements_[id].cost = cost; }
+    /**
+     * Get the ids of the elements at positions
+     * ['position_start', 'position_end') of the sorted array, in order.
+     */
+    inline std::vector<ElementId> get_range(
+            Position position_start,
+            Position position_end,
+            std::mt19937_64& generator);
 
-    ElementId get(Position position, std::mt19937_64& generator);
+    /**
+     * Get the ids of the 'k' elements with the smallest costs.
+     *
+     * The elements are not returned in any particular order.
+     */
+    inline std::vector<ElementId> top_k(
+            Position k,
+            std::mt19937_64& generator);
+
+    /*
+     * Setters
+     */
+
+    /**
+     * Set the cost of an element.
+     *
+     * If the cost decreases (resp. increases) and becomes smaller (resp.
+     * greater) than the largest (resp. smallest) element of the previous
+     * (resp. next) interval, the element is swapped with it. This is repeated
+     * until the order between the intervals is restored. Therefore, only the
+     * intervals crossed by the element are read, and no interval needs to be
+     * partitioned again.
+     */
+    inline void set_cost(ElementId id, Cost cost);
 
 private:
 
-    inline void swap(Position position_1, Position position_2)
+    /*
+     * Private attributes
+     */
+
+    /** Elements. */
+    std::vector<Element> elements_;
+
+    /** For each element, its position in the 'elements_' vector. */
+    std::vector<Position> positions_;
+
+    /**
+     * Bitset of size 'number_of_elements + 1'.
+     *
+     * Bit 'p' is set iff the elements at positions before 'p' are not greater
+     * than the elements at positions from 'p'.
+     */
+    std::vector<uint64_t> boundaries_;
+
+    /*
+     * Private methods
+     */
+
+    /** Size of the intervals which are sorted instead of partitioned. */
+    static constexpr Position sort_threshold_ = 128;
+
+    /** Return 'true' iff a position is a boundary. */
+    inline bool is_boundary(Position position) const
     {
-        Element tmp = elements_[position_1];
+        return (boundaries_[position >> 6] >> (position & 63)) & 1;
+    }
+
+    /** Set all the positions in ['position_first', 'position_last'] as boundaries. */
+    inline void set_boundaries(
+            Position position_first,
+            Position position_last)
+    {
+        for (Position position = position_first;
+                position <= position_last;
+                ++position) {
+            boundaries_[position >> 6] |= ((uint64_t)1 << (position & 63));
+        }
+    }
+
+    /** Get the largest boundary smaller than or equal to a position. */
+    inline Position previous_boundary(Position position) const;
+
+    /** Get the smallest boundary strictly greater than a position. */
+    inline Position next_boundary(Position position) const;
+
+    /** Partition the array such that 'position' becomes a boundary. */
+    inline void split(
+            Position position,
+            std::mt19937_64& generator);
+
+    /** Swap the elements at two positions. */
+    inline void swap(
+            Position position_1,
+            Position position_2)
+    {
+        Element element = elements_[position_1];
         elements_[position_1] = elements_[position_2];
-        elements_[position_2] = tmp;
-    };
+        elements_[position_2] = element;
+        positions_[elements_[position_1].id] = position_1;
+        positions_[elements_[position_2].id] = position_2;
+    }
 
-    std::vector<Element> elements_;
+    /** Update the positions of the elements of the interval ['start', 'end'). */
+    inline void update_positions(
+            Position start,
+            Position end)
+    {
+        for (Position position = start; position < end; ++position)
+            positions_[elements_[position].id] = position;
+    }
+
+    /** Sort the interval ['start', 'end'). */
+    inline void sort(
+            Position start,
+            Position end);
+
+    /**
+     * Move the elements of ['start', 'end') whose cost compares to the cost of
+     * the pivot before the others and return the first position of the
+     * others.
+     *
+     * The loop is branchless: each element is swapped unconditionally and
+     * the insertion position is increased by the result of the comparison.
+     */
+    template <typename Compare>
+    inline Position partition(
+            Position start,
+            Position end,
+            Cost cost_pivot,
+            Compare compare);
 
 };
 
-void SortedOnDemandArray::reset(ElementId number_of_elements)
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+inline void SortedOnDemandArray::reset(ElementId number_of_elements)
 {
     elements_.clear();
     elements_.resize(number_of_elements);
+    positions_.clear();
+    positions_.resize(number_of_elements);
     for (Position position = 0; position < number_of_elements; ++position) {
         elements_[position].id = position;
-        elements_[position].interval_start = 0;
-        elements_[position].interval_end   = number_of_elements - 1;
+        elements_[position].cost = 0;
+        positions_[position] = position;
     }
+    boundaries_.clear();
+    boundaries_.resize(number_of_elements / 64 + 1, 0);
+    set_boundaries(0, 0);
+    set_boundaries(number_of_elements, number_of_elements);
 }
 
-bool compare_elements(const Element& element_1, const Element& element_2)
+inline Position SortedOnDemandArray::previous_boundary(Position position) const
 {
-    return element_1.cost < element_2.cost;
+    Position word_id = position >> 6;
+    uint64_t word = boundaries_[word_id] & (~(uint64_t)0 >> (63 - (position & 63)));
+    // Position '0' is always a boundary.
+    while (word == 0) {
+        word_id--;
+        word = boundaries_[word_id];
+    }
+    return (word_id << 6) + highest_bit(word);
 }
 
-ElementId SortedOnDemandArray::get(Position position, std::mt19937_64& generator)
+inline Position SortedOnDemandArray::next_boundary(Position position) const
 {
-    assert(position >= 0);
-    assert(position < (Position)elements_.size());
-    while (elements_[position].interval_start != elements_[position].interval_end) {
-        Position start = elements_[position].interval_start;
-        Position end   = elements_[position].interval_end;
-        if (end - start < 128) {
-            std::sort(elements_.begin() + start, elements_.begin() + end + 1, compare_elements);
-            for (Position p = start; p <= end; ++p) {
-                elements_[p].interval_start = p;
-                elements_[p].interval_end   = p;
-            }
+    position++;
+    Position word_id = position >> 6;
+    uint64_t word = boundaries_[word_id] & (~(uint64_t)0 << (position & 63));
+    // Position 'number_of_elements' is always a boundary.
+    while (word == 0) {
+        word_id++;
+        word = boundaries_[word_id];
+    }
+    return (word_id << 6) + lowest_bit(word);
+}
+
+template <typename Compare>
+inline Position SortedOnDemandArray::partition(
+        Position start,
+        Position end,
+        Cost cost_pivot,
+        Compare compare)
+{
+    Position first = start;
+    for (Position position = start; position < end; ++position) {
+        Element element = elements_[position];
+        elements_[position] = elements_[first];
+        elements_[first] = element;
+        first += compare(element.cost, cost_pivot);
+    }
+    return first;
+}
+
+inline void SortedOnDemandArray::sort(
+        Position start,
+        Position end)
+{
+    std::sort(
+            elements_.begin() + start,
+            elements_.begin() + end,
+            [](const Element& element_1, const Element& element_2) -> bool
+            {
+                return element_1.cost < element_2.cost;
+            });
+    update_positions(start, end);
+    set_boundaries(start, end);
+}
+
+inline void SortedOnDemandArray::split(
+        Position position,
+        std::mt19937_64& generator)
+{
+    if (is_boundary(position))
+        return;
+
+    // Maximum number of partition steps before falling back to
+    // 'std::nth_element'.
+    Position start = previous_boundary(position);
+    Position end = next_boundary(position);
+    Position number_of_steps_max = 2;
+    for (Position size = end - start; size > 1; size >>= 1)
+        number_of_steps_max += 2;
+
+    // The positions of the moved elements are updated once at the end.
+    Position start_initial = start;
+    Position end_initial = end;
+
+    for (Position number_of_steps = 0;; ++number_of_steps) {
+        if (end - start <= sort_threshold_) {
+            sort(start, end);
+            break;
+        }
+
+        if (number_of_steps == number_of_steps_max) {
+            std::nth_element(
+                    elements_.begin() + start,
+                    elements_.begin() + position,
+                    elements_.begin() + end,
+                    [](const Element& element_1, const Element& element_2) -> bool
+                    {
+                        return element_1.cost < element_2.cost;
+                    });
+            set_boundaries(position, position + 1);
+            break;
+        }
+
+        // Select pivot.
+        std::uniform_int_distribution<Position> distribution(start, end - 1);
+        Cost cost_pivot = elements_[distribution(generator)].cost;
+
+        // Partition.
+        //
+        // | | | | | | | | | | | | | | | | | | | | |
+        // start      f           l                 end
+        // < pivot   |  = pivot  |      > pivot
+        //
+        Position f = partition(start, end, cost_pivot, std::less<Cost>());
+        Position l = partition(f, end, cost_pivot, std::less_equal<Cost>());
+
+        // All the positions of the block of elements equal to the pivot are
+        // boundaries.
+        set_boundaries(f, l);
+
+        if (position < f) {
+            end = f;
+        } else if (position > l) {
+            start = l;
         } else {
-            // Select pivot
-            std::uniform_int_distribution<Position> distribution(start + 1, end - 1);
-            Position pivot = distribution(generator);
-            Cost cost_pivot = elements_[pivot].cost;
-
-            // Partition
-            swap(pivot, end);
-            Position f = start;
-            Position l = end;
-            Position p = start;
-            while (p <= l) {
-                if (elements_[p].cost < cost_pivot) {
-                    swap(p, f);
-                    f++;
-                    p++;
-                } else if (elements_[p].cost > cost_pivot) {
-                    swap(p, l);
-                    l--;
-                } else {
-                    p++;
-                }
-            }
-
-            // | | | | | | | | | | | | | | | | | | | | |
-            //          f       p           l
-            // -------|                       |-------
-            // > pivot                         < pivot
-            //
-            for (Position p = start; p < f; ++p) {
-                elements_[p].interval_start = start;
-                elements_[p].interval_end   = f;
-            }
-            for (Position p = f; p <= l; ++p) {
-                elements_[p].interval_start = p;
-                elements_[p].interval_end   = p;
-            }
-            for (Position p = l + 1; p <= end; ++p) {
-                elements_[p].interval_start = l + 1;
-                elements_[p].interval_end   = end;
-            }
+            break;
         }
     }
+    update_positions(start_initial, end_initial);
+}
+
+inline void SortedOnDemandArray::set_cost(
+        ElementId id,
+        Cost cost)
+{
+    Position position = positions_[id];
+    Cost cost_old = elements_[position].cost;
+    elements_[position].cost = cost;
+
+    if (cost < cost_old) {
+        for (;;) {
+            Position start = previous_boundary(position);
+            if (start == 0)
+                break;
+            // Find the largest element of the previous interval.
+            Position position_max = previous_boundary(start - 1);
+            for (Position p = position_max + 1; p < start; ++p)
+                if (elements_[p].cost > elements_[position_max].cost)
+                    position_max = p;
+            if (elements_[position_max].cost <= cost)
+                break;
+            swap(position, position_max);
+            position = position_max;
+        }
+    } else if (cost > cost_old) {
+        for (;;) {
+            Position end = next_boundary(position);
+            if (end == (Position)elements_.size())
+                break;
+            // Find the smallest element of the next interval.
+            Position position_min = end;
+            Position end_next = next_boundary(end);
+            for (Position p = end + 1; p < end_next; ++p)
+                if (elements_[p].cost < elements_[position_min].cost)
+                    position_min = p;
+            if (elements_[position_min].cost >= cost)
+                break;
+            swap(position, position_min);
+            position = position_min;
+        }
+    }
+}
+
+inline ElementId SortedOnDemandArray::get(
+        Position position,
+        std::mt19937_64& generator)
+{
+    assert(position >= 0);
+    assert(position < (Position)elements_.size());
+    split(position, generator);
+    split(position + 1, generator);
     return elements_[position].id;
 }
 
+inline std::vector<ElementId> SortedOnDemandArray::get_range(
+        Position position_start,
+        Position position_end,
+        std::mt19937_64& generator)
+{
+    assert(position_start >= 0);
+    assert(position_start <= position_end);
+    assert(position_end <= (Position)elements_.size());
+    split(position_start, generator);
+    split(position_end, generator);
+
+    // All the intervals between 'position_start' and 'position_end' are now
+    // entirely requested, therefore, they are sorted.
+    std::vector<ElementId> element_ids;
+    element_ids.reserve(position_end - position_start);
+    Position position = position_start;
+    while (position < position_end) {
+        Position position_next = next_boundary(position);
+        if (position_next - position > 1)
+            sort(position, position_next);
+        for (; position < position_next; ++position)
+            element_ids.push_back(elements_[position].id);
+    }
+    return element_ids;
 }
 
+inline std::vector<ElementId> SortedOnDemandArray::top_k(
+        Position k,
+        std::mt19937_64& generator)
+{
+    assert(k >= 0);
+    assert(k <= (Position)elements_.size());
+    split(k, generator);
+    std::vector<ElementId> element_ids(k);
+    for (Position position = 0; position < k; ++position)
+        element_ids[position] = elements_[position].id;
+    return element_ids;
+}
+
+}
@@ -74,6 +74,11 @@ public:
     /**
      * Returns an iterator pointing to the first element in the neighbors of
      * vertex 'v'.
+     *
+     * Some implementations write the neighbors in a vector shared by all
+     * calls. Therefore, the iterators are invalidated by the next call, and
+     * these methods must not be called concurrently on the same graph. Use
+     * 'neighbors' or 'for_each_neighbor' instead.
      */
     virtual const_iterator neighbors_begin(VertexId vertex_id) const = 0;
 
@@ -83,6 +88,48 @@ public:
      */
     virtual const_iterator neighbors_end(VertexId vertex_id) const = 0;
 
+    /**
+     * Get the neighbors of a vertex.
+     *
+     * If the graph doesn't store the neighbors of the vertex, they are
+     * written in 'neighbors' and a reference to 'neighbors' is returned.
+     * Otherwise, a reference to the stored neighbors is returned and
+     * 'neighbors' is not modified.
+     *
+     * Since the scratch vector is owned by the caller, this method can be
+     * called concurrently on the same graph, and nested calls are possible.
+     *
+     * The default implementation copies the range
+     * ['neighbors_begin', 'neighbors_end') and is therefore not thread-safe.
+     */
+    virtual const std::vector<VertexId>& neighbors(
+            VertexId vertex_id,
+            std::vector<VertexId>& neighbors) const
+    {
+        neighbors.assign(neighbors_begin(vertex_id), neighbors_end(vertex_id));
+        return neighbors;
+    }
+
+    /**
+     * Call 'function(neighbor_id)' for each neighbor of a vertex.
+     *
+     * Algorithms templated on the graph type only use 'number_of_vertices',
+     * 'number_of_edges', 'degree', 'weight' and 'for_each_neighbor'. The
+     * concrete graph classes hide this method with a non-virtual version
+     * which can be inlined. This version goes through the virtual method
+     * 'neighbors' and is used when the algorithm is called on an
+     * 'AbstractGraph'.
+     */
+    template <typename Function>
+    inline void for_each_neighbor(
+            VertexId vertex_id,
+            Function function) const
+    {
+        std::vector<VertexId> neighbors_tmp;
+        for (VertexId neighbor_id: neighbors(vertex_id, neighbors_tmp))
+            function(neighbor_id);
+    }
+
     Weight compute_total_weight()
     {
         Weight total_weight = 0;
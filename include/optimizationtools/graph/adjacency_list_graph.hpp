@@ -64,7 +64,12 @@ public:
     inline AdjacencyListGraph(
             const AbstractGraph& abstract_graph);
 
-    /** Create the complementary of a graph. */
+    /**
+     * Create the complementary of a graph.
+     *
+     * This requires O(n^2) time and memory. See ComplementGraphView to work
+     * on the complementary of a large sparse graph.
+     */
     AdjacencyListGraph complementary() const;
 
     virtual AdjacencyListGraph* clone() const override
@@ -76,32 +81,49 @@ public:
      * Getters
      */
 
-    inline VertexPos number_of_vertices() const override { return vertices_.size(); }
+    inline VertexPos number_of_vertices() const override final { return vertices_.size(); }
 
     inline const Vertex& vertex(VertexId vertex_id) const { return vertices_[vertex_id]; }
 
-    inline virtual VertexPos number_of_edges() const override { return number_of_edges_; }
+    inline virtual VertexPos number_of_edges() const override final { return number_of_edges_; }
 
     inline const Edge& edge(EdgeId edge_id) const { return edges_[edge_id]; }
 
-    inline VertexId degree(VertexId vertex_id) const override { return vertices_[vertex_id].edges.size(); }
+    inline VertexId degree(VertexId vertex_id) const override final { return vertices_[vertex_id].edges.size(); }
 
-    inline virtual VertexPos highest_degree() const override { return highest_degree_; }
+    inline virtual VertexPos highest_degree() const override final { return highest_degree_; }
 
-    inline Weight weight(VertexId vertex_id) const override { return vertices_[vertex_id].weight; }
+    inline Weight weight(VertexId vertex_id) const override final { return vertices_[vertex_id].weight; }
 
-    virtual Weight total_weight() const override { return total_weight_; };
+    virtual Weight total_weight() const override final { return total_weight_; };
 
-    const_iterator neighbors_begin(VertexId vertex_id) const override
+    const_iterator neighbors_begin(VertexId vertex_id) const override final
     {
         return vertices_[vertex_id].neighbors.begin();
     }
 
-    const_iterator neighbors_end(VertexId vertex_id) const override
+    const_iterator neighbors_end(VertexId vertex_id) const override final
     {
         return vertices_[vertex_id].neighbors.end();
     }
 
+    const std::vector<VertexId>& neighbors(
+            VertexId vertex_id,
+            std::vector<VertexId>&) const override final
+    {
+        return vertices_[vertex_id].neighbors;
+    }
+
+    /** Call 'function(neighbor_id)' for each neighbor of a vertex. */
+    template <typename Function>
+    inline void for_each_neighbor(
+            VertexId vertex_id,
+            Function function) const
+    {
+        for (VertexId neighbor_id: vertices_[vertex_id].neighbors)
+            function(neighbor_id);
+    }
+
     /** Get the first end of an edge. */
     inline VertexId first_end(EdgeId edge_id) const { return edges_[edge_id].vertex_1_id; }
 
@@ -121,14 +143,36 @@ public:
     /** Get the list of edges incident to a vertex. */
     inline const std::vector<VertexEdge>& edges(VertexId vertex_id) const { return vertices_[vertex_id].edges; }
 
+    /**
+     * Get the number of connected components.
+     *
+     * Return '-1' if the connected components have not been computed.
+     */
+    inline ComponentId number_of_components() const { return number_of_components_; }
+
+    /** Get the connected component of a vertex. */
+    inline ComponentId component(VertexId vertex_id) const { return vertices_[vertex_id].component; }
+
     /*
      * Export
      */
 
-    /** Write the graph to a file. */
+    /**
+     * Write the graph to a file.
+     *
+     * Available formats:
+     * - 'snap', 'matrixmarket', 'dimacs': text formats; the edges are
+     *   formatted in parallel with 'number_of_threads' threads into large
+     *   buffers which are written in order
+     * - 'binary': the number of vertices, the number of edges, the weights of
+     *   the vertices and the ends of the edges, stored as 64-bit values in the
+     *   native byte order after an 8-byte header "OTGRAPH1"; it can be read
+     *   back with 'AdjacencyListGraphBuilder::read'
+     */
     void write(
             const std::string& instance_path,
-            const std::string& format) const;
+            const std::string& format,
+            int number_of_threads = 1) const;
 
 private:
 
@@ -151,6 +195,9 @@ private:
     /** Total weight. */
     Weight total_weight_ = 0;
 
+    /** Number of connected components, '-1' if they have not been computed. */
+    ComponentId number_of_components_ = -1;
+
     /*
      * Private methods
      */
@@ -159,13 +206,22 @@ private:
     inline AdjacencyListGraph() { };
 
     /** Write graph in 'snap' format. */
-    void write_snap(std::ofstream& file) const;
+    void write_snap(
+            std::ofstream& file,
+            int number_of_threads) const;
 
     /** Write graph in 'matrixmarket' format. */
-    void write_matrixmarket(std::ofstream& file) const;
+    void write_matrixmarket(
+            std::ofstream& file,
+            int number_of_threads) const;
 
     /** Write graph in 'dimacs' foramt. */
-    void write_dimacs(std::ofstream& file) const;
+    void write_dimacs(
+            std::ofstream& file,
+            int number_of_threads) const;
+
+    /** Write graph in 'binary' format. */
+    void write_binary(std::ofstream& file) const;
 
     friend class AdjacencyListGraphBuilder;
 };
@@ -178,11 +234,24 @@ public:
     /** Constructor. */
     AdjacencyListGraphBuilder() { };
 
-    /** Read a graph from a file. */
+    /** Read a graph from a file (see 'read_graph'). */
     void read(
             const std::string& instance_path,
             const std::string& format);
 
+    /** Get the number of vertices added so far. */
+    inline VertexId number_of_vertices() const { return graph_.number_of_vertices(); }
+
+    /**
+     * Reserve memory for a given number of vertices and edges.
+     *
+     * This avoids the reallocations of the arrays of vertices and edges when
+     * their final sizes are known in advance.
+     */
+    void reserve(
+            VertexId number_of_vertices,
+            EdgeId number_of_edges);
+
     /** Add a vertex. */
     virtual VertexId add_vertex(Weight weight = 1);
 
@@ -205,18 +274,57 @@ public:
     /** Clear the edges of the graph. */
     void clear_edges();
 
-    /** Remove duplicate edges (changes the edge ids). */
-    void remove_duplicate_edges();
+    /**
+     * Remove duplicate edges (changes the edge ids).
+     *
+     * The edges are sorted by increasing first end, then by increasing
+     * second end, where the first end of an edge is its smallest end.
+     * Therefore, the neighbors of each vertex are sorted afterwards.
+     *
+     * The edges are gathered in a single array and sorted with a radix sort
+     * using 'number_of_threads' threads, then the adjacency lists are
+     * rebuilt in a single pass.
+     */
+    void remove_duplicate_edges(int number_of_threads = 1);
 
     /** Create the complementary of a graph. */
     AdjacencyListGraph complementary() const;
 
+    /**
+     * Build a graph from a list of edges.
+     *
+     * Edge 'i' of the list gets id 'i', the self-loops being skipped as in
+     * 'add_edge'. If 'weights' is empty, all the vertices have weight 1.
+     *
+     * The degrees are counted first so that each adjacency list is
+     * allocated once with its final size. The edges are split into one
+     * chunk per thread; each thread counts the ends of its chunk at each
+     * vertex, which gives, after a prefix sum over the threads, the position
+     * of its chunk in each adjacency list. Then each thread only writes the
+     * ends of its own chunk, so the total work is O(n * number_of_threads +
+     * m), with O(n * number_of_threads) additional memory. The result
+     * doesn't depend on the number of threads.
+     */
+    static AdjacencyListGraph build_from_edge_list(
+            VertexId number_of_vertices,
+            const std::vector<std::pair<VertexId, VertexId>>& edges,
+            const std::vector<Weight>& weights = {},
+            int number_of_threads = 1);
+
     /*
      * Build
      */
 
-    /** Build. */
-    AdjacencyListGraph build();
+    /**
+     * Build.
+     *
+     * If 'compute_components' is 'true', the connected components are
+     * computed with 'number_of_threads' threads (see 'connected_components')
+     * and stored in the vertices.
+     */
+    AdjacencyListGraph build(
+            bool compute_components = false,
+            int number_of_threads = 1);
 
 private:
 
@@ -231,21 +339,32 @@ private:
      * Private methods
      */
 
-    /** Read a graph in 'dimacs1992' format. */
-    void read_dimacs1992(std::ifstream& file);
-
-    /** Read a graph in 'dimacs2010' format. */
-    void read_dimacs2010(std::ifstream& file);
-
-    /** Read a graph in 'matrixmarket' format. */
-    void read_matrixmarket(std::ifstream& file);
-
-    /** Read a graph in 'chaco' format. */
-    void read_chaco(std::ifstream& file);
-
-    /** Read a graph in 'snap' format. */
-    void read_snap(std::ifstream& file);
+    /**
+     * Replace the edges of the graph.
+     *
+     * The adjacency lists are allocated once with their final size, then
+     * filled with 'number_of_threads' threads (see 'build_from_edge_list').
+     */
+    void set_edges(
+            std::vector<AdjacencyListGraph::Edge>&& edges,
+            int number_of_threads = 1);
 
 };
 
+/**
+ * Build the subgraph induced by a set of vertices.
+ *
+ * 'vertex_ids' contains the vertices by increasing id, without duplicates.
+ * Vertex 'i' of the subgraph is vertex 'vertex_ids[i]' of the graph; the
+ * neighbors which are not in 'vertex_ids' are skipped.
+ *
+ * The ids of the neighbors in the subgraph are found by dichotomy in
+ * 'vertex_ids', so that no array of size 'graph.number_of_vertices()' is
+ * needed. This requires a time O(d log n'), where n' is the size of
+ * 'vertex_ids' and d the sum of the degrees of its vertices in the graph.
+ */
+AdjacencyListGraph induced_subgraph(
+        const AdjacencyListGraph& graph,
+        const std::vector<VertexId>& vertex_ids);
+
 }
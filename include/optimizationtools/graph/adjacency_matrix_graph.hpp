@@ -44,19 +44,26 @@ public:
      * Getters
      */
 
-    inline VertexPos number_of_vertices() const override { return vertices_.size(); }
+    inline VertexPos number_of_vertices() const override final { return vertices_.size(); }
 
-    inline EdgeId number_of_edges() const override { return number_of_edges_; }
+    inline EdgeId number_of_edges() const override final { return number_of_edges_; }
 
-    inline VertexId degree(VertexId v) const override { return vertices_[v].degree; }
+    inline VertexId degree(VertexId v) const override final { return vertices_[v].degree; }
 
-    virtual VertexPos highest_degree() const override { return highest_degree_; }
+    virtual VertexPos highest_degree() const override final { return highest_degree_; }
 
-    inline Weight weight(VertexId v) const override { return vertices_[v].weight; }
+    inline Weight weight(VertexId v) const override final { return vertices_[v].weight; }
 
-    virtual Weight total_weight() const override { return total_weight_; };
+    virtual Weight total_weight() const override final { return total_weight_; };
 
-    virtual const_iterator neighbors_begin(VertexId vertex_id) const override
+    /**
+     * Returns an iterator pointing to the first element in the neighbors of
+     * vertex 'v'.
+     *
+     * The neighbors are written in a vector shared by all calls. Use
+     * 'neighbors' or 'for_each_neighbor' to iterate from several threads.
+     */
+    virtual const_iterator neighbors_begin(VertexId vertex_id) const override final
     {
         neighbors_tmp_.clear();
         for (VertexId vertex_id_2 = 0; vertex_id_2 < number_of_vertices(); ++vertex_id_2)
@@ -65,11 +72,45 @@ public:
         return neighbors_tmp_.begin();
     }
 
-    virtual const_iterator neighbors_end(VertexId) const override
+    virtual const_iterator neighbors_end(VertexId) const override final
     {
         return neighbors_tmp_.end();
     }
 
+    virtual const std::vector<VertexId>& neighbors(
+            VertexId vertex_id,
+            std::vector<VertexId>& neighbors) const override final
+    {
+        neighbors.clear();
+        for_each_neighbor(
+                vertex_id,
+                [&neighbors](VertexId neighbor_id) { neighbors.push_back(neighbor_id); });
+        return neighbors;
+    }
+
+    /**
+     * Call 'function(neighbor_id)' for each neighbor of a vertex.
+     *
+     * The row of the vertex is scanned directly, without filling
+     * 'neighbors_tmp_'. Therefore, this method can be called concurrently.
+     */
+    template <typename Function>
+    inline void for_each_neighbor(
+            VertexId vertex_id,
+            Function function) const
+    {
+        const std::vector<bool>& row = adjacency_matrix_[vertex_id];
+        for (VertexId vertex_id_2 = 0; vertex_id_2 < vertex_id; ++vertex_id_2)
+            if (row[vertex_id_2])
+                function(vertex_id_2);
+        for (VertexId vertex_id_2 = vertex_id + 1;
+                vertex_id_2 < number_of_vertices();
+                ++vertex_id_2) {
+            if (adjacency_matrix_[vertex_id_2][vertex_id])
+                function(vertex_id_2);
+        }
+    }
+
     /**
      * Return 'true' iff there is an edge between two vertices exists.
      */
@@ -1,15 +1,243 @@
+#pragma once
+
 #include "optimizationtools/graph/adjacency_list_graph.hpp"
 
 namespace optimizationtools
 {
 
+/**
+ * Compute the sides of the vertices of a bipartite graph.
+ *
+ * Return an empty vector if the graph is not bipartite.
+ *
+ * 'Graph' can be any graph type providing 'number_of_vertices' and
+ * 'for_each_neighbor' (see 'traversal.hpp').
+ */
+template <typename Graph>
 std::vector<uint8_t> bipartite_graph_identify(
-        const AdjacencyListGraph& graph);
+        const Graph& graph);
+
+/**
+ * Bipartite graph with the sides of its vertices and, once computed, a
+ * maximum matching and a minimum vertex cover.
+ *
+ * The sides are computed once, or provided, at construction. The edges are
+ * then stored in compressed sparse row form from side 0, the side from which
+ * the alternating searches of the matching and cover algorithms start; from
+ * side 1, these searches only follow the matched edge, which is stored for
+ * each vertex.
+ *
+ * The matching and the cover are computed at the first call and returned
+ * from the cache afterwards, so that repeated computations on the same graph
+ * don't traverse it again.
+ *
+ * The handle keeps a reference to the graph, which must outlive it.
+ */
+class BipartiteGraph
+{
+
+public:
+
+    /*
+     * Constructors and destructor
+     */
+
+    /**
+     * Create a bipartite graph, computing the sides of its vertices.
+     *
+     * Throw an 'std::invalid_argument' exception if the graph is not
+     * bipartite.
+     */
+    BipartiteGraph(const AdjacencyListGraph& graph);
+
+    /**
+     * Create a bipartite graph from precomputed sides, for example returned
+     * by 'bipartite_graph_identify'.
+     *
+     * The sides are not checked beyond their number.
+     */
+    BipartiteGraph(
+            const AdjacencyListGraph& graph,
+            const std::vector<uint8_t>& vertices_sides);
+
+    /*
+     * Getters
+     */
+
+    /** Get the graph. */
+    inline const AdjacencyListGraph& graph() const { return *graph_; }
+
+    /** Get the side of each vertex. */
+    inline const std::vector<uint8_t>& vertices_sides() const { return vertices_sides_; }
+
+    /** Get the side of a vertex. */
+    inline uint8_t side(VertexId vertex_id) const { return vertices_sides_[vertex_id]; }
+
+    /** Get the vertices of a side. */
+    inline const std::vector<VertexId>& vertices(uint8_t side) const { return vertices_[side]; }
+
+    /**
+     * Call 'function(vertex_edge)' for each edge incident to a vertex of
+     * side 0.
+     */
+    template <typename Function>
+    inline void for_each_edge(
+            VertexId vertex_id,
+            Function function) const
+    {
+        for (EdgeId pos = edges_offsets_[vertex_id];
+                pos < edges_offsets_[vertex_id + 1];
+                ++pos) {
+            function(edges_[pos]);
+        }
+    }
+
+    /**
+     * Compute a maximum matching.
+     *
+     * Return, for each edge, '1' if it belongs to the matching, '0'
+     * otherwise.
+     */
+    const std::vector<uint8_t>& maximum_matching();
+
+    /** Get the size of the maximum matching. */
+    inline EdgeId matching_size() { maximum_matching(); return matching_size_; }
+
+    /**
+     * Get the edge of the maximum matching incident to a vertex, '-1' if the
+     * vertex is not matched.
+     */
+    inline EdgeId matched_edge(VertexId vertex_id) { maximum_matching(); return vertices_matched_edge_[vertex_id]; }
+
+    /**
+     * Compute a minimum vertex cover from the maximum matching, with the
+     * construction of Kőnig's theorem.
+     *
+     * Return, for each vertex, '1' if it belongs to the cover, '0' otherwise.
+     */
+    const std::vector<uint8_t>& minimum_cover();
+
+private:
+
+    /*
+     * Private methods
+     */
+
+    /** Build the edges from side 0. */
+    void build_edges();
+
+    /*
+     * Private attributes
+     */
 
+    /** Graph. */
+    const AdjacencyListGraph* graph_;
+
+    /** Side of each vertex. */
+    std::vector<uint8_t> vertices_sides_;
+
+    /** Vertices of each side. */
+    std::vector<VertexId> vertices_[2];
+
+    /**
+     * For each vertex, the position of its first edge in 'edges_', followed
+     * by the total number of edges; the vertices of side 1 have no edges.
+     */
+    std::vector<EdgeId> edges_offsets_;
+
+    /** Edges of the vertices of side 0. */
+    std::vector<AdjacencyListGraph::VertexEdge> edges_;
+
+    /** 'true' iff the maximum matching has been computed. */
+    bool matching_is_computed_ = false;
+
+    /** For each edge, '1' iff it belongs to the maximum matching. */
+    std::vector<uint8_t> edges_matched_;
+
+    /** For each vertex, its matched edge, '-1' if it is not matched. */
+    std::vector<EdgeId> vertices_matched_edge_;
+
+    /** Size of the maximum matching. */
+    EdgeId matching_size_ = 0;
+
+    /** 'true' iff the minimum cover has been computed. */
+    bool cover_is_computed_ = false;
+
+    /** For each vertex, '1' iff it belongs to the minimum cover. */
+    std::vector<uint8_t> cover_;
+
+};
+
+/**
+ * Compute a maximum matching of a bipartite graph.
+ *
+ * To compute several results on the same graph, use a BipartiteGraph.
+ */
 std::vector<uint8_t> bipartite_graph_maximum_matching(
         const AdjacencyListGraph& graph);
 
+/** Compute a maximum matching of a bipartite graph with precomputed sides. */
+std::vector<uint8_t> bipartite_graph_maximum_matching(
+        const AdjacencyListGraph& graph,
+        const std::vector<uint8_t>& vertices_sides);
+
+/**
+ * Compute a minimum vertex cover of a bipartite graph.
+ *
+ * To compute several results on the same graph, use a BipartiteGraph.
+ */
 std::vector<uint8_t> bipartite_graph_minimum_cover(
         const AdjacencyListGraph& graph);
 
+/**
+ * Compute a minimum vertex cover of a bipartite graph with precomputed
+ * sides.
+ */
+std::vector<uint8_t> bipartite_graph_minimum_cover(
+        const AdjacencyListGraph& graph,
+        const std::vector<uint8_t>& vertices_sides);
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename Graph>
+std::vector<uint8_t> bipartite_graph_identify(
+        const Graph& graph)
+{
+    if (graph.number_of_vertices() == 0)
+        return {};
+    std::vector<uint8_t> vertices_sides(graph.number_of_vertices(), 2);
+    std::vector<VertexId> queue;
+    bool is_bipartite = true;
+    for (VertexId vertex_0_id = 0;
+            vertex_0_id < graph.number_of_vertices();
+            ++vertex_0_id) {
+        if (vertices_sides[vertex_0_id] != 2)
+            continue;
+
+        queue.push_back(vertex_0_id);
+        vertices_sides[vertex_0_id] = 0;
+        while (!queue.empty()) {
+            VertexId vertex_id = queue.back();
+            queue.pop_back();
+            uint8_t side = vertices_sides[vertex_id];
+            graph.for_each_neighbor(
+                    vertex_id,
+                    [&vertices_sides, &queue, &is_bipartite, side](VertexId neighbor_id)
+                    {
+                        if (vertices_sides[neighbor_id] == side)
+                            is_bipartite = false;
+                        if (vertices_sides[neighbor_id] != 2)
+                            return;
+                        vertices_sides[neighbor_id] = 1 - side;
+                        queue.push_back(neighbor_id);
+                    });
+            if (!is_bipartite)
+                return {};
+        }
+    }
+    return vertices_sides;
+}
+
 }
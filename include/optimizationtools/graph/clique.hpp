@@ -1,5 +1,11 @@
+#pragma once
+
 #include "optimizationtools/graph/adjacency_list_graph.hpp"
 
+#include "optimizationtools/utils/output.hpp"
+
+#include <iomanip>
+
 namespace optimizationtools
 {
 
@@ -24,9 +30,14 @@ namespace optimizationtools
  * the highest weight.
  *
  * Duplicate cliques are removed.
+ *
+ * 'Graph' is one of 'AbstractGraph', 'AdjacencyListGraph',
+ * 'AdjacencyMatrixGraph', 'CliqueGraph', 'ComplementGraphView' and
+ * 'CompressedGraph'.
  */
+template <typename Graph>
 std::vector<std::vector<VertexId>> edge_clique_cover(
-        const AdjacencyListGraph& graph);
+        const Graph& graph);
 
 /**
  * Compute an vertex clique cover of the graph.
@@ -35,9 +46,18 @@ std::vector<std::vector<VertexId>> edge_clique_cover(
  * with the highest weight.
  *
  * Duplicate cliques are removed.
+ *
+ * The cliques are built in parallel with 'number_of_threads' threads. The
+ * result doesn't depend on the number of threads.
+ *
+ * 'Graph' is one of 'AbstractGraph', 'AdjacencyListGraph',
+ * 'AdjacencyMatrixGraph', 'CliqueGraph', 'ComplementGraphView' and
+ * 'CompressedGraph'.
  */
+template <typename Graph>
 std::vector<std::vector<VertexId>> vertex_clique_cover(
-        const AdjacencyListGraph& graph);
+        const Graph& graph,
+        int number_of_threads = 1);
 
 /**
  * Compute an edge clique partition of the graph.
@@ -55,9 +75,14 @@ std::vector<std::vector<VertexId>> edge_clique_partition(
  * For each vertex, it is added to the maximum-weight compatible clique. If
  * there is no compatible clique, a new clique contaiing only this vertex is
  * added.
+ *
+ * 'Graph' is one of 'AbstractGraph', 'AdjacencyListGraph',
+ * 'AdjacencyMatrixGraph', 'CliqueGraph', 'ComplementGraphView' and
+ * 'CompressedGraph'.
  */
+template <typename Graph>
 std::vector<std::vector<VertexId>> vertex_clique_partition_1(
-        const AdjacencyListGraph& graph);
+        const Graph& graph);
 
 /**
  * Compute a vertex clique partition of the graph.
@@ -73,4 +98,82 @@ std::vector<std::vector<VertexId>> vertex_clique_partition_1(
 std::vector<std::vector<VertexId>> vertex_clique_partition_2(
         const AdjacencyListGraph& graph);
 
+/**
+ * Parameters of the maximum-weight clique algorithm.
+ */
+struct MaximumWeightCliqueParameters: Parameters
+{
+    /** Number of threads. */
+    int number_of_threads = 1;
+
+
+    virtual int format_width() const override { return 23; }
+
+    virtual void format(std::ostream& os) const override
+    {
+        Parameters::format(os);
+        int width = format_width();
+        os
+            << std::setw(width) << std::left << "Number of threads: " << number_of_threads << std::endl
+            ;
+    }
+
+    virtual nlohmann::json to_json() const override
+    {
+        nlohmann::json json = Parameters::to_json();
+        json.merge_patch({
+                {"NumberOfThreads", number_of_threads}});
+        return json;
+    }
+};
+
+/**
+ * Output of the maximum-weight clique algorithm.
+ */
+struct MaximumWeightCliqueOutput: Output
+{
+    /** Best clique found. */
+    std::vector<VertexId> clique;
+
+    /** Weight of the best clique found. */
+    Weight weight = 0;
+
+    /** Upper bound on the weight of a clique. */
+    Weight bound = 0;
+
+    /** Number of nodes of the branch-and-bound. */
+    Counter number_of_nodes = 0;
+
+    /** Elapsed time. */
+    double time = 0.0;
+};
+
+/**
+ * Compute a maximum-weight clique of a graph with a branch-and-bound.
+ *
+ * The vertices are sorted in a degeneracy ordering (see 'k_core.hpp'). For
+ * each vertex, a subproblem searches for the best clique made of the vertex
+ * and of its neighbors which are after it in the ordering. A subproblem has
+ * at most 'degeneracy' candidates, so its candidate sets and its adjacency
+ * matrix are stored as bitsets. A subproblem is skipped if the weight of its
+ * vertex and of all its candidates is not larger than the weight of the best
+ * clique found.
+ *
+ * In each node, the candidates are greedily colored; since a clique contains
+ * at most one vertex per color class, the sum of the largest weights of the
+ * color classes is an upper bound. The initial solution is built greedily
+ * from the end of the degeneracy ordering, i.e. from the densest core.
+ *
+ * The subproblems are split between 'number_of_threads' threads, which
+ * share the best clique found.
+ *
+ * The vertices with a non-positive weight are ignored. The algorithm stops
+ * when 'parameters.timer.needs_to_end()' returns 'true'; then, 'bound' is
+ * an upper bound computed from the unsolved subproblems. Otherwise, the
+ * clique is optimal and 'bound' is equal to its weight.
+ */
+MaximumWeightCliqueOutput maximum_weight_clique(
+        const AdjacencyListGraph& graph,
+        const MaximumWeightCliqueParameters& parameters = {});
+
 }
@@ -6,6 +6,7 @@
 
 #include <cstdint>
 #include <vector>
+#include <algorithm>
 
 namespace optimizationtools
 {
@@ -52,20 +53,30 @@ public:
      * Getters
      */
 
-    inline VertexPos number_of_vertices() const override { return vertices_.size(); }
+    inline VertexPos number_of_vertices() const override final { return vertices_.size(); }
 
-    inline EdgeId number_of_edges() const override { return number_of_edges_; }
+    inline EdgeId number_of_edges() const override final { return number_of_edges_; }
 
-    inline VertexId degree(VertexId vertex_id) const override { return vertices_[vertex_id].degree; }
+    inline VertexId degree(VertexId vertex_id) const override final { return vertices_[vertex_id].degree; }
 
-    virtual VertexPos highest_degree() const override { return highest_degree_; }
+    virtual VertexPos highest_degree() const override final { return highest_degree_; }
 
-    inline Weight weight(VertexId vertex_id) const override { return vertices_[vertex_id].weight; }
+    inline Weight weight(VertexId vertex_id) const override final { return vertices_[vertex_id].weight; }
 
-    virtual Weight total_weight() const override { return total_weight_; };
+    virtual Weight total_weight() const override final { return total_weight_; };
 
-    virtual const_iterator neighbors_begin(VertexId vertex_id) const override
+    /**
+     * Returns an iterator pointing to the first element in the neighbors of
+     * vertex 'v'.
+     *
+     * If the neighbors have not been materialized, they are written in a
+     * set shared by all calls. Use 'neighbors' or 'for_each_neighbor' to
+     * iterate from several threads.
+     */
+    virtual const_iterator neighbors_begin(VertexId vertex_id) const override final
     {
+        if (has_neighbors())
+            return neighbors_.begin() + neighbors_offsets_[vertex_id];
         if (vertex_id != vertex_id_tmp_) {
             neighbors_tmp_.clear();
             for (CliqueId clique_id: vertices_[vertex_id].cliques)
@@ -77,11 +88,137 @@ public:
         return neighbors_tmp_.begin();
     }
 
-    inline virtual const_iterator neighbors_end(VertexId) const override
+    inline virtual const_iterator neighbors_end(VertexId vertex_id) const override final
     {
+        if (has_neighbors())
+            return neighbors_.begin() + neighbors_offsets_[vertex_id + 1];
         return neighbors_tmp_.end();
     }
 
+    virtual const std::vector<VertexId>& neighbors(
+            VertexId vertex_id,
+            std::vector<VertexId>& neighbors) const override final
+    {
+        if (has_neighbors()) {
+            neighbors.assign(
+                    neighbors_.begin() + neighbors_offsets_[vertex_id],
+                    neighbors_.begin() + neighbors_offsets_[vertex_id + 1]);
+            return neighbors;
+        }
+        neighbors.clear();
+        for_each_neighbor(
+                vertex_id,
+                [&neighbors](VertexId neighbor_id) { neighbors.push_back(neighbor_id); });
+        return neighbors;
+    }
+
+    /**
+     * Call 'function(neighbor_id)' for each neighbor of a vertex.
+     *
+     * If the neighbors have been materialized, they are read in increasing
+     * order. Otherwise, no shared state is used either: a vertex of the 'i'-th clique of 'v' is
+     * reported iff it doesn't belong to one of the previous cliques of 'v',
+     * which is checked by intersecting the sorted clique lists of the two
+     * vertices. Therefore, this method can be called concurrently, and
+     * 'function' may iterate over the neighbors of another vertex.
+     */
+    template <typename Function>
+    inline void for_each_neighbor(
+            VertexId vertex_id,
+            Function function) const
+    {
+        if (has_neighbors()) {
+            for (EdgeId pos = neighbors_offsets_[vertex_id];
+                    pos < neighbors_offsets_[vertex_id + 1];
+                    ++pos) {
+                function(neighbors_[pos]);
+            }
+            return;
+        }
+        const std::vector<CliqueId>& vertex_cliques = vertices_[vertex_id].cliques;
+        for (auto it = vertex_cliques.begin(); it != vertex_cliques.end(); ++it) {
+            for (VertexId vertex_id_2: cliques_[*it]) {
+                if (vertex_id_2 == vertex_id)
+                    continue;
+                if (it != vertex_cliques.begin()
+                        && have_common_clique(
+                            vertex_cliques.begin(),
+                            it,
+                            vertices_[vertex_id_2].cliques.begin(),
+                            vertices_[vertex_id_2].cliques.end())) {
+                    continue;
+                }
+                function(vertex_id_2);
+            }
+        }
+    }
+
+    /**
+     * Call 'function(neighbor_id)' for each neighbor of a vertex.
+     *
+     * The neighbors are deduplicated with 'neighbors', a set of size
+     * 'number_of_vertices()' owned by the caller. This is faster than the
+     * version without scratch when the vertex belongs to many cliques.
+     */
+    template <typename Function>
+    inline void for_each_neighbor(
+            VertexId vertex_id,
+            Function function,
+            IndexedSet& neighbors) const
+    {
+        if (has_neighbors()) {
+            for_each_neighbor(vertex_id, function);
+            return;
+        }
+        neighbors.clear();
+        for (CliqueId clique_id: vertices_[vertex_id].cliques) {
+            for (VertexId vertex_id_2: cliques_[clique_id]) {
+                if (vertex_id_2 == vertex_id
+                        || neighbors.contains(vertex_id_2)) {
+                    continue;
+                }
+                neighbors.add(vertex_id_2);
+                function(vertex_id_2);
+            }
+        }
+    }
+
+    /**
+     * Return 'true' iff the neighbors of the vertices have been materialized
+     * by 'CliqueGraphBuilder::build'.
+     */
+    inline bool has_neighbors() const { return !neighbors_offsets_.empty(); }
+
+    /**
+     * Return 'true' iff two vertices are adjacent.
+     *
+     * If the neighbors have been materialized, the neighbors of the vertex
+     * with the smallest degree are searched by dichotomy. Otherwise, the
+     * sorted lists of cliques of the two vertices are intersected.
+     */
+    inline bool has_edge(
+            VertexId vertex_id_1,
+            VertexId vertex_id_2) const
+    {
+        if (vertex_id_1 == vertex_id_2)
+            return false;
+        if (has_neighbors()) {
+            if (neighbors_offsets_[vertex_id_1 + 1] - neighbors_offsets_[vertex_id_1]
+                    > neighbors_offsets_[vertex_id_2 + 1] - neighbors_offsets_[vertex_id_2]) {
+                std::swap(vertex_id_1, vertex_id_2);
+            }
+            return std::binary_search(
+                    neighbors_.begin() + neighbors_offsets_[vertex_id_1],
+                    neighbors_.begin() + neighbors_offsets_[vertex_id_1 + 1],
+                    vertex_id_2);
+        }
+        return have_common_clique(
+                vertices_[vertex_id_1].cliques.begin(),
+                vertices_[vertex_id_1].cliques.end(),
+                vertices_[vertex_id_2].cliques.begin(),
+                vertices_[vertex_id_2].cliques.end());
+    }
+
 private:
 
     /*
@@ -103,6 +240,16 @@ private:
     /** Maximum degree. */
     Weight total_weight_ = 0;
 
+    /**
+     * If the neighbors have been materialized, for each vertex, the position
+     * of its first neighbor in 'neighbors_', followed by the total number of
+     * neighbors; empty otherwise.
+     */
+    std::vector<EdgeId> neighbors_offsets_;
+
+    /** Sorted neighbors of all vertices, without duplicates. */
+    std::vector<VertexId> neighbors_;
+
     /** Vector filled and returned by the 'adjacency_list' method. */
     mutable IndexedSet neighbors_tmp_;
 
@@ -113,6 +260,25 @@ private:
      * Private methods
      */
 
+    /** Return 'true' iff two sorted lists of cliques intersect. */
+    static inline bool have_common_clique(
+            std::vector<CliqueId>::const_iterator it_1,
+            std::vector<CliqueId>::const_iterator it_1_end,
+            std::vector<CliqueId>::const_iterator it_2,
+            std::vector<CliqueId>::const_iterator it_2_end)
+    {
+        while (it_1 != it_1_end && it_2 != it_2_end) {
+            if (*it_1 < *it_2) {
+                ++it_1;
+            } else if (*it_2 < *it_1) {
+                ++it_2;
+            } else {
+                return true;
+            }
+        }
+        return false;
+    }
+
     /** Create an empty graph. */
     inline CliqueGraph():
         AbstractGraph(),
@@ -157,15 +323,55 @@ public:
      * Build
      */
 
-    /** Build. */
-    CliqueGraph build()
+    /**
+     * Return an upper bound on the number of bytes required to materialize
+     * the neighbors of the graph currently built.
+     *
+     * The bound counts '2 * number_of_edges()' vertex ids and one offset per
+     * vertex. It is not tight when some edges are shared by several cliques.
+     */
+    std::size_t materialized_neighbors_number_of_bytes() const
+    {
+        return (graph_.number_of_vertices() + 1) * sizeof(EdgeId)
+            + 2 * graph_.number_of_edges() * sizeof(VertexId);
+    }
+
+    /**
+     * Build.
+     *
+     * The list of cliques of each vertex is sorted.
+     *
+     * If 'materialize_neighbors' is 'true', the deduplicated neighbors of
+     * all vertices are computed once and stored in compressed sparse row
+     * form; the neighbors are then obtained without any computation. The
+     * caller decides whether the memory permits it, for example with
+     * 'materialized_neighbors_number_of_bytes' or with
+     * 'build_within_memory_budget'.
+     */
+    CliqueGraph build(bool materialize_neighbors = false)
     {
+        for (CliqueGraph::Vertex& vertex: graph_.vertices_)
+            std::sort(vertex.cliques.begin(), vertex.cliques.end());
         graph_.total_weight_ = graph_.compute_total_weight();
         graph_.highest_degree_ = graph_.compute_highest_degree();
         graph_.neighbors_tmp_ = optimizationtools::IndexedSet(graph_.number_of_vertices());
+        graph_.neighbors_offsets_.clear();
+        graph_.neighbors_.clear();
+        if (materialize_neighbors)
+            compute_neighbors();
         return std::move(graph_);
     }
 
+    /**
+     * Build, materializing the neighbors iff
+     * 'materialized_neighbors_number_of_bytes()' does not exceed
+     * 'maximum_number_of_bytes'.
+     */
+    CliqueGraph build_within_memory_budget(std::size_t maximum_number_of_bytes)
+    {
+        return build(materialized_neighbors_number_of_bytes() <= maximum_number_of_bytes);
+    }
+
 private:
 
     /*
@@ -182,6 +388,9 @@ private:
     /** Read a graph in 'default' format. */
     void read_cliquegraph(std::ifstream& file);
 
+    /** Compute the neighbors of the vertices in compressed sparse row form. */
+    void compute_neighbors();
+
 };
 
 }
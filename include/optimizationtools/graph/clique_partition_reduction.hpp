@@ -0,0 +1,172 @@
+#pragma once
+
+#include "optimizationtools/graph/dynamic_graph.hpp"
+
+#include <vector>
+#include <iostream>
+
+namespace optimizationtools
+{
+
+/**
+ * Kernelization for the minimum vertex clique partition problem, i.e.
+ * partitioning the vertices of a graph into a minimum number of cliques
+ * (equivalently, coloring its complementary graph).
+ *
+ * The following rules are applied until none applies:
+ * - Isolated vertex: a vertex without neighbors forms a clique on its own.
+ * - Pendant vertex: a vertex 'v' with a single neighbor 'u' forms the clique
+ *   '{v, u}'; if 'u' belongs to another clique in a solution, moving it to
+ *   the clique of 'v' doesn't increase the number of cliques.
+ * - Domination: if two adjacent vertices 'u' and 'v' are such that
+ *   N[u] ⊆ N[v] (closed neighborhoods), 'v' is removed; it is then added to
+ *   the clique of 'u', whose vertices all belong to N[u]. This includes
+ *   the adjacent twins, i.e. N[u] = N[v].
+ *
+ * These rules are exact: a minimum partition of the kernel is lifted to a
+ * minimum partition of the graph. The weights of the vertices are ignored.
+ *
+ * The graph is reduced as a DynamicGraph. The vertices to check are stored
+ * in a worklist; when a vertex is removed, its neighbors, whose
+ * neighborhoods changed, are added back to the worklist. Checking the
+ * domination of a vertex 'u' costs O(deg(u)^2) adjacency tests, so it is
+ * only checked for the vertices of degree at most
+ * 'maximum_domination_degree'.
+ *
+ * Each application of a rule is recorded in a stack, which 'lift' unwinds
+ * in reverse order to complete a partition of the kernel.
+ */
+class VertexCliquePartitionReduction
+{
+
+public:
+
+    /*
+     * Structures
+     */
+
+    /** Reduction rules. */
+    enum class Rule
+    {
+        Isolated,
+        Pendant,
+        Domination,
+    };
+
+    /** Structure that stores an application of a rule. */
+    struct Reduction
+    {
+        /** Rule. */
+        Rule rule;
+
+        /** Removed vertex. */
+        VertexId vertex_id;
+
+        /**
+         * For 'Pendant', the removed neighbor; for 'Domination', the
+         * dominated vertex whose clique the removed vertex joins; '-1'
+         * otherwise.
+         */
+        VertexId vertex_2_id;
+    };
+
+    /*
+     * Constructors and destructor
+     */
+
+    /** Reduce a graph. */
+    VertexCliquePartitionReduction(
+            const AdjacencyListGraph& graph,
+            VertexPos maximum_domination_degree = 64);
+
+    /*
+     * Getters
+     */
+
+    /** Get the kernel. */
+    inline const AdjacencyListGraph& kernel() const { return kernel_; }
+
+    /** Get the id in the original graph of each vertex of the kernel. */
+    inline const std::vector<VertexId>& original_vertex_ids() const { return original_vertex_ids_; }
+
+    /** Get the applied reductions, in order. */
+    inline const std::vector<Reduction>& reductions() const { return reductions_; }
+
+    /** Get the number of vertices removed by a rule. */
+    inline VertexId number_of_removed_vertices(Rule rule) const { return number_of_removed_vertices_[(int)rule]; }
+
+    /** Get the number of cliques built by the rules. */
+    inline VertexId number_of_cliques() const { return number_of_cliques_; }
+
+    /** Get the time spent reducing the graph. */
+    inline double time() const { return time_; }
+
+    /**
+     * Lift a vertex clique partition of the kernel, with the vertex ids of
+     * the kernel, to a vertex clique partition of the original graph.
+     */
+    std::vector<std::vector<VertexId>> lift(
+            const std::vector<std::vector<VertexId>>& kernel_cliques) const;
+
+    /** Write the statistics of the reduction to a stream. */
+    void format(std::ostream& os) const;
+
+private:
+
+    /*
+     * Private methods
+     */
+
+    /** Apply the rules until none applies and build the kernel. */
+    AdjacencyListGraph reduce(VertexPos maximum_domination_degree);
+
+    /** Remove a vertex and add its neighbors to the worklist. */
+    void remove_vertex(VertexId vertex_id);
+
+    /**
+     * Look for a neighbor of a vertex dominating it and remove it.
+     *
+     * Return 'true' iff such a neighbor has been found.
+     */
+    bool reduce_domination(VertexId vertex_id);
+
+    /*
+     * Private attributes
+     */
+
+    /** Number of vertices of the original graph. */
+    VertexId number_of_vertices_;
+
+    /** Number of edges of the original graph. */
+    EdgeId number_of_edges_;
+
+    /** Graph being reduced. */
+    DynamicGraph graph_;
+
+    /** Vertices to check. */
+    IndexedSet worklist_;
+
+    /** Neighbors of the vertex being checked. */
+    std::vector<VertexId> neighbors_tmp_;
+
+    /** Applied reductions, in order. */
+    std::vector<Reduction> reductions_;
+
+    /** For each rule, the number of vertices removed. */
+    std::vector<VertexId> number_of_removed_vertices_ = std::vector<VertexId>(3, 0);
+
+    /** Number of cliques built by the rules. */
+    VertexId number_of_cliques_ = 0;
+
+    /** Id in the original graph of each vertex of the kernel. */
+    std::vector<VertexId> original_vertex_ids_;
+
+    /** Time spent reducing the graph. */
+    double time_ = 0.0;
+
+    /** Kernel; initialized last, by 'reduce'. */
+    AdjacencyListGraph kernel_;
+
+};
+
+}
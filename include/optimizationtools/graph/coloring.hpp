@@ -0,0 +1,114 @@
+#pragma once
+
+#include "optimizationtools/graph/adjacency_list_graph.hpp"
+
+#include <vector>
+#include <random>
+
+namespace optimizationtools
+{
+
+/*
+ * Vertex coloring.
+ *
+ * A coloring assigns a color to each vertex such that two adjacent vertices
+ * have different colors. The vertices of a clique have pairwise different
+ * colors, so the number of colors of a coloring is an upper bound on the
+ * size of a clique. The color classes of a coloring of the complementary
+ * graph (see 'ComplementGraphView') form a vertex clique partition.
+ */
+
+typedef int64_t ColorId;
+
+/**
+ * Structure storing a coloring.
+ */
+struct Coloring
+{
+    /** For each vertex, its color. */
+    std::vector<ColorId> colors;
+
+    /** Number of colors. */
+    ColorId number_of_colors = 0;
+};
+
+/**
+ * Orderings of the vertices for the greedy coloring.
+ */
+enum class ColoringOrdering
+{
+    /** Increasing id. */
+    Natural,
+
+    /** Non-increasing degree. */
+    LargestFirst,
+
+    /**
+     * Reverse degeneracy ordering (see 'k_core.hpp'). Each vertex has at most
+     * 'degeneracy' neighbors before it, so at most 'degeneracy + 1' colors
+     * are used.
+     */
+    SmallestLast,
+};
+
+/**
+ * Color the vertices greedily in a given order, each vertex taking the
+ * smallest color not used by its neighbors.
+ *
+ * The colors of the neighbors of a vertex 'v' are marked in a bitset; only
+ * the colors up to 'degree(v)' need to be marked, since one of them is free.
+ * The smallest free color is then found one 64-bit word at a time.
+ *
+ * 'Graph' is one of 'AbstractGraph', 'AdjacencyListGraph',
+ * 'AdjacencyMatrixGraph', 'CliqueGraph', 'ComplementGraphView' and
+ * 'CompressedGraph'.
+ */
+template <typename Graph>
+Coloring greedy_coloring(
+        const Graph& graph,
+        const std::vector<VertexId>& ordering);
+
+/** Color the vertices greedily in a given type of ordering. */
+Coloring greedy_coloring(
+        const AdjacencyListGraph& graph,
+        ColoringOrdering ordering = ColoringOrdering::SmallestLast);
+
+/**
+ * Color the vertices greedily in a random ordering, drawn with
+ * 'IndexedSet::shuffle'.
+ */
+Coloring greedy_coloring(
+        const AdjacencyListGraph& graph,
+        std::mt19937_64& generator);
+
+/**
+ * Color the vertices with the DSATUR algorithm of Brélaz.
+ *
+ * At each step, the uncolored vertex with the highest saturation, i.e. the
+ * largest number of different colors among its neighbors, is colored with
+ * the smallest free color; ties are broken by highest degree.
+ *
+ * The uncolored vertices are stored in a bucket queue with one bucket per
+ * saturation and distinct degree. When the saturation of a vertex
+ * increases, the vertex is pushed in its new bucket and its previous entry
+ * is skipped when it is popped. Therefore, apart from the scans of the empty
+ * buckets, the algorithm takes a time O(n + m).
+ *
+ * The colors of the neighbors of each vertex are stored in a bitset of at
+ * least 'degree + 1' bits; its first 64 bits are stored with the saturation
+ * of the vertex, so that updating a neighbor usually touches a single cache
+ * line. A neighbor color larger than the bitset, which rarely happens, is
+ * checked by scanning the neighbors.
+ *
+ * The running time is dominated by the accesses to the neighbors of the
+ * colored vertices, which are scattered in memory, so it is several times
+ * the one of 'greedy_coloring'.
+ *
+ * 'Graph' is one of 'AbstractGraph', 'AdjacencyListGraph',
+ * 'AdjacencyMatrixGraph', 'CliqueGraph', 'ComplementGraphView' and
+ * 'CompressedGraph'.
+ */
+template <typename Graph>
+Coloring dsatur_coloring(const Graph& graph);
+
+}
@@ -0,0 +1,283 @@
+#pragma once
+
+#include "optimizationtools/graph/adjacency_list_graph.hpp"
+
+#include <iterator>
+#include <algorithm>
+
+namespace optimizationtools
+{
+
+/**
+ * Complementary graph of an AdjacencyListGraph, computed on the fly.
+ *
+ * Two distinct vertices are adjacent in the view iff they are not adjacent in
+ * the original graph.
+ *
+ * The complementary graph is never built. The view only stores a sorted copy
+ * of the adjacency lists of the original graph without duplicate neighbors,
+ * in O(n + m) memory. Then:
+ * - the degree of a vertex is obtained in O(1)
+ * - the adjacency between two vertices is checked in O(log(degree))
+ * - the neighbors of a vertex are enumerated by iterating through all the
+ *   vertices and skipping the ones of its sorted adjacency list
+ *
+ * The view keeps a reference to the original graph, which must outlive it.
+ */
+class ComplementGraphView: public AbstractGraph
+{
+
+public:
+
+    /*
+     * Structures
+     */
+
+    /**
+     * Iterator over the neighbors of a vertex in the complementary graph, in
+     * increasing order.
+     */
+    class NeighborIterator
+    {
+
+    public:
+
+        typedef std::forward_iterator_tag iterator_category;
+        typedef VertexId value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const VertexId* pointer;
+        typedef const VertexId& reference;
+
+        /** Constructor. */
+        NeighborIterator(
+                VertexId vertex_id,
+                VertexId current_vertex_id,
+                VertexId number_of_vertices,
+                const VertexId* adjacency_current,
+                const VertexId* adjacency_end):
+            vertex_id_(vertex_id),
+            current_vertex_id_(current_vertex_id),
+            number_of_vertices_(number_of_vertices),
+            adjacency_current_(adjacency_current),
+            adjacency_end_(adjacency_end)
+        {
+            skip();
+        }
+
+        inline const VertexId& operator*() const { return current_vertex_id_; }
+
+        inline NeighborIterator& operator++()
+        {
+            current_vertex_id_++;
+            skip();
+            return *this;
+        }
+
+        inline NeighborIterator operator++(int)
+        {
+            NeighborIterator it = *this;
+            ++(*this);
+            return it;
+        }
+
+        inline bool operator==(const NeighborIterator& it) const { return current_vertex_id_ == it.current_vertex_id_; }
+
+        inline bool operator!=(const NeighborIterator& it) const { return current_vertex_id_ != it.current_vertex_id_; }
+
+    private:
+
+        /** Vertex whose neighbors are enumerated. */
+        VertexId vertex_id_;
+
+        /** Current neighbor. */
+        VertexId current_vertex_id_;
+
+        /** Number of vertices of the graph. */
+        VertexId number_of_vertices_;
+
+        /**
+         * First element of the sorted adjacency list of the vertex in the
+         * original graph which is not smaller than the current neighbor.
+         */
+        const VertexId* adjacency_current_;
+
+        /** End of the sorted adjacency list of the vertex. */
+        const VertexId* adjacency_end_;
+
+        /** Move to the next vertex which is a neighbor, starting from the current one. */
+        inline void skip()
+        {
+            while (current_vertex_id_ < number_of_vertices_) {
+                while (adjacency_current_ != adjacency_end_
+                        && *adjacency_current_ < current_vertex_id_) {
+                    adjacency_current_++;
+                }
+                if (current_vertex_id_ != vertex_id_
+                        && (adjacency_current_ == adjacency_end_
+                            || *adjacency_current_ != current_vertex_id_)) {
+                    return;
+                }
+                current_vertex_id_++;
+            }
+        }
+
+    };
+
+    /** Range of the neighbors of a vertex in the complementary graph. */
+    struct Neighbors
+    {
+        NeighborIterator begin_;
+        NeighborIterator end_;
+
+        inline NeighborIterator begin() const { return begin_; }
+        inline NeighborIterator end() const { return end_; }
+    };
+
+    /*
+     * Constructors and destructor
+     */
+
+    /** Create a view of the complementary graph of a graph. */
+    ComplementGraphView(const AdjacencyListGraph& graph);
+
+    virtual ComplementGraphView* clone() const override
+    {
+        return new ComplementGraphView(*this);
+    }
+
+    /*
+     * Getters
+     */
+
+    /** Get the original graph. */
+    inline const AdjacencyListGraph& graph() const { return *graph_; }
+
+    inline VertexPos number_of_vertices() const override final { return graph_->number_of_vertices(); }
+
+    inline EdgeId number_of_edges() const override final { return number_of_edges_; }
+
+    inline VertexPos degree(VertexId vertex_id) const override final
+    {
+        return number_of_vertices() - 1
+            - (adjacency_offsets_[vertex_id + 1] - adjacency_offsets_[vertex_id]);
+    }
+
+    inline VertexPos highest_degree() const override final { return highest_degree_; }
+
+    inline Weight weight(VertexId vertex_id) const override final { return graph_->weight(vertex_id); }
+
+    inline Weight total_weight() const override final { return graph_->total_weight(); }
+
+    /**
+     * Return 'true' iff two vertices are adjacent in the complementary graph.
+     */
+    inline bool has_edge(
+            VertexId vertex_id_1,
+            VertexId vertex_id_2) const
+    {
+        return vertex_id_1 != vertex_id_2
+            && !std::binary_search(
+                    adjacency_.begin() + adjacency_offsets_[vertex_id_1],
+                    adjacency_.begin() + adjacency_offsets_[vertex_id_1 + 1],
+                    vertex_id_2);
+    }
+
+    /**
+     * Get the neighbors of a vertex in the complementary graph.
+     *
+     * The neighbors are computed while iterating, without memory allocation.
+     */
+    inline Neighbors neighbors(VertexId vertex_id) const
+    {
+        const VertexId* adjacency_begin = adjacency_.data() + adjacency_offsets_[vertex_id];
+        const VertexId* adjacency_end = adjacency_.data() + adjacency_offsets_[vertex_id + 1];
+        Neighbors neighbors = {
+            NeighborIterator(vertex_id, 0, number_of_vertices(), adjacency_begin, adjacency_end),
+            NeighborIterator(vertex_id, number_of_vertices(), number_of_vertices(), adjacency_end, adjacency_end)};
+        return neighbors;
+    }
+
+    /**
+     * Returns an iterator pointing to the first element in the neighbors of
+     * vertex 'v'.
+     *
+     * The neighbors are written in a vector shared by all calls. Use
+     * 'neighbors' to iterate without materializing them.
+     */
+    virtual const_iterator neighbors_begin(VertexId vertex_id) const override final
+    {
+        neighbors_tmp_.clear();
+        for (VertexId vertex_id_2: neighbors(vertex_id))
+            neighbors_tmp_.push_back(vertex_id_2);
+        return neighbors_tmp_.begin();
+    }
+
+    virtual const_iterator neighbors_end(VertexId) const override final
+    {
+        return neighbors_tmp_.end();
+    }
+
+    virtual const std::vector<VertexId>& neighbors(
+            VertexId vertex_id,
+            std::vector<VertexId>& neighbors) const override final
+    {
+        neighbors.clear();
+        for_each_neighbor(
+                vertex_id,
+                [&neighbors](VertexId neighbor_id) { neighbors.push_back(neighbor_id); });
+        return neighbors;
+    }
+
+    /** Call 'function(neighbor_id)' for each neighbor of a vertex. */
+    template <typename Function>
+    inline void for_each_neighbor(
+            VertexId vertex_id,
+            Function function) const
+    {
+        const VertexId* adjacency_it = adjacency_.data() + adjacency_offsets_[vertex_id];
+        const VertexId* adjacency_end = adjacency_.data() + adjacency_offsets_[vertex_id + 1];
+        for (VertexId vertex_id_2 = 0;
+                vertex_id_2 < number_of_vertices();
+                ++vertex_id_2) {
+            if (adjacency_it != adjacency_end && *adjacency_it == vertex_id_2) {
+                ++adjacency_it;
+                continue;
+            }
+            if (vertex_id_2 != vertex_id)
+                function(vertex_id_2);
+        }
+    }
+
+private:
+
+    /*
+     * Private attributes
+     */
+
+    /** Original graph. */
+    const AdjacencyListGraph* graph_;
+
+    /**
+     * For each vertex, the position of its adjacency list in the
+     * 'adjacency_' vector.
+     */
+    std::vector<EdgeId> adjacency_offsets_;
+
+    /**
+     * Sorted adjacency lists of the original graph, without duplicate
+     * neighbors.
+     */
+    std::vector<VertexId> adjacency_;
+
+    /** Number of edges. */
+    EdgeId number_of_edges_ = 0;
+
+    /** Maximum degree. */
+    VertexPos highest_degree_ = 0;
+
+    /** Vector filled and returned by the 'neighbors_begin' method. */
+    mutable std::vector<VertexId> neighbors_tmp_;
+
+};
+
+}
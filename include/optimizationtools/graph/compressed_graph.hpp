@@ -0,0 +1,334 @@
+#pragma once
+
+#include "optimizationtools/graph/abstract_graph.hpp"
+
+#include <cstdint>
+#include <vector>
+#include <iterator>
+
+namespace optimizationtools
+{
+
+/**
+ * Graph whose adjacency lists are stored compressed.
+ *
+ * The neighbors of each vertex are sorted and stored as the differences
+ * between consecutive neighbors (the first neighbor being stored as is),
+ * each difference being encoded as a variable-length integer of 7 bits per
+ * byte, the highest bit of a byte indicating whether the next byte belongs
+ * to the same integer. Each list starts with the degree of the vertex,
+ * encoded the same way.
+ *
+ * For sparse graphs whose vertices have neighbors with close ids, most
+ * differences fit in one or two bytes, against 32 bytes per neighbor for an
+ * AdjacencyListGraph. Reordering the vertices beforehand (see
+ * 'reordering.hpp') improves the compression.
+ *
+ * The neighbors are decoded while iterating. Therefore, accessing them is a
+ * bit slower than with an AdjacencyListGraph; checking if two vertices are
+ * adjacent requires a time linear in the smallest degree of the two
+ * vertices.
+ */
+class CompressedGraph: public AbstractGraph
+{
+
+public:
+
+    /*
+     * Structures
+     */
+
+    /**
+     * Iterator decoding the neighbors of a vertex, in increasing order.
+     */
+    class NeighborIterator
+    {
+
+    public:
+
+        typedef std::forward_iterator_tag iterator_category;
+        typedef VertexId value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const VertexId* pointer;
+        typedef const VertexId& reference;
+
+        /** Constructor. */
+        NeighborIterator(
+                const uint8_t* data,
+                VertexPos number_of_remaining_neighbors):
+            data_(data),
+            number_of_remaining_neighbors_(number_of_remaining_neighbors)
+        {
+            if (number_of_remaining_neighbors_ > 0)
+                current_vertex_id_ = decode(data_);
+        }
+
+        inline const VertexId& operator*() const { return current_vertex_id_; }
+
+        inline NeighborIterator& operator++()
+        {
+            number_of_remaining_neighbors_--;
+            if (number_of_remaining_neighbors_ > 0)
+                current_vertex_id_ += decode(data_);
+            return *this;
+        }
+
+        inline NeighborIterator operator++(int)
+        {
+            NeighborIterator it = *this;
+            ++(*this);
+            return it;
+        }
+
+        inline bool operator==(const NeighborIterator& it) const { return number_of_remaining_neighbors_ == it.number_of_remaining_neighbors_; }
+
+        inline bool operator!=(const NeighborIterator& it) const { return number_of_remaining_neighbors_ != it.number_of_remaining_neighbors_; }
+
+    private:
+
+        /** Next byte to decode. */
+        const uint8_t* data_;
+
+        /** Number of neighbors not yet enumerated, including the current one. */
+        VertexPos number_of_remaining_neighbors_;
+
+        /** Current neighbor. */
+        VertexId current_vertex_id_ = -1;
+
+    };
+
+    /** Range of the neighbors of a vertex. */
+    struct Neighbors
+    {
+        NeighborIterator begin_;
+        NeighborIterator end_;
+
+        inline NeighborIterator begin() const { return begin_; }
+        inline NeighborIterator end() const { return end_; }
+    };
+
+    /*
+     * Constructors and destructor
+     */
+
+    /** Create a compressed graph from another graph. */
+    CompressedGraph(const AbstractGraph& graph);
+
+    virtual CompressedGraph* clone() const override
+    {
+        return new CompressedGraph(*this);
+    }
+
+    /*
+     * Getters
+     */
+
+    inline VertexPos number_of_vertices() const override final { return offsets_.size() - 1; }
+
+    inline EdgeId number_of_edges() const override final { return number_of_edges_; }
+
+    inline VertexPos degree(VertexId vertex_id) const override final
+    {
+        const uint8_t* data = data_.data() + offsets_[vertex_id];
+        return decode(data);
+    }
+
+    inline VertexPos highest_degree() const override final { return highest_degree_; }
+
+    inline Weight weight(VertexId vertex_id) const override final { return (weights_.empty())? 1: weights_[vertex_id]; }
+
+    inline Weight total_weight() const override final { return total_weight_; }
+
+    /** Get the number of bytes used to store the adjacency lists. */
+    inline std::size_t number_of_bytes() const { return data_.size(); }
+
+    /**
+     * Get the neighbors of a vertex.
+     *
+     * The neighbors are decoded while iterating, without memory allocation.
+     */
+    inline Neighbors neighbors(VertexId vertex_id) const
+    {
+        const uint8_t* data = data_.data() + offsets_[vertex_id];
+        VertexPos degree = decode(data);
+        Neighbors neighbors = {
+            NeighborIterator(data, degree),
+            NeighborIterator(nullptr, 0)};
+        return neighbors;
+    }
+
+    /**
+     * Returns an iterator pointing to the first element in the neighbors of
+     * vertex 'v'.
+     *
+     * The neighbors are written in a vector shared by all calls. Use
+     * 'neighbors' to iterate without materializing them.
+     */
+    virtual const_iterator neighbors_begin(VertexId vertex_id) const override final
+    {
+        neighbors_tmp_.clear();
+        for_each_neighbor(
+                vertex_id,
+                [this](VertexId neighbor_id) { neighbors_tmp_.push_back(neighbor_id); });
+        return neighbors_tmp_.begin();
+    }
+
+    virtual const_iterator neighbors_end(VertexId) const override final
+    {
+        return neighbors_tmp_.end();
+    }
+
+    virtual const std::vector<VertexId>& neighbors(
+            VertexId vertex_id,
+            std::vector<VertexId>& neighbors) const override final
+    {
+        neighbors.clear();
+        for_each_neighbor(
+                vertex_id,
+                [&neighbors](VertexId neighbor_id) { neighbors.push_back(neighbor_id); });
+        return neighbors;
+    }
+
+    /** Call 'function(neighbor_id)' for each neighbor of a vertex. */
+    template <typename Function>
+    inline void for_each_neighbor(
+            VertexId vertex_id,
+            Function function) const
+    {
+        const uint8_t* data = data_.data() + offsets_[vertex_id];
+        VertexPos degree = decode(data);
+        VertexId neighbor_id = 0;
+        for (VertexPos pos = 0; pos < degree; ++pos) {
+            neighbor_id += decode(data);
+            function(neighbor_id);
+        }
+    }
+
+    /** Return 'true' iff two vertices are adjacent. */
+    bool has_edge(
+            VertexId vertex_id_1,
+            VertexId vertex_id_2) const;
+
+    /*
+     * Encoding
+     */
+
+    /**
+     * Write a non-negative integer as a variable-length integer at the end of
+     * a vector of bytes.
+     */
+    static inline void encode(
+            uint64_t value,
+            std::vector<uint8_t>& data)
+    {
+        while (value >= 128) {
+            data.push_back((uint8_t)(value | 128));
+            value >>= 7;
+        }
+        data.push_back((uint8_t)value);
+    }
+
+    /**
+     * Read a variable-length integer and move the pointer past its last
+     * byte.
+     */
+    static inline uint64_t decode(const uint8_t*& data)
+    {
+        uint64_t value = *data & 127;
+        int shift = 7;
+        while (*(data++) & 128) {
+            value |= (uint64_t)(*data & 127) << shift;
+            shift += 7;
+        }
+        return value;
+    }
+
+private:
+
+    /*
+     * Private methods
+     */
+
+    /** Constructor for the CompressedGraphBuilder. */
+    CompressedGraph(): offsets_(1, 0) { }
+
+    /*
+     * Private attributes
+     */
+
+    /** For each vertex, the position of its adjacency list in 'data_'. */
+    std::vector<uint64_t> offsets_;
+
+    /** Encoded adjacency lists. */
+    std::vector<uint8_t> data_;
+
+    /** Weights of the vertices; empty if all the weights are equal to 1. */
+    std::vector<Weight> weights_;
+
+    /** Number of edges. */
+    EdgeId number_of_edges_ = 0;
+
+    /** Maximum degree. */
+    VertexPos highest_degree_ = 0;
+
+    /** Total weight. */
+    Weight total_weight_ = 0;
+
+    /** Vector filled and returned by the 'neighbors_begin' method. */
+    mutable std::vector<VertexId> neighbors_tmp_;
+
+    friend class CompressedGraphBuilder;
+};
+
+/**
+ * Builder of a CompressedGraph.
+ *
+ * The vertices are added in order with their neighbors, so that the graph
+ * can be built without ever storing it uncompressed, for example while
+ * reading the adjacency lists from a file.
+ */
+class CompressedGraphBuilder
+{
+
+public:
+
+    /** Constructor. */
+    CompressedGraphBuilder() { };
+
+    /**
+     * Add a vertex with its neighbors.
+     *
+     * The neighbors don't need to be sorted; duplicate neighbors and
+     * self-loops are removed. The adjacency must be symmetric, i.e. if 'u'
+     * is a neighbor of 'v', then 'v' must be a neighbor of 'u'; this is not
+     * checked.
+     */
+    VertexId add_vertex(
+            const std::vector<VertexId>& neighbors,
+            Weight weight = 1);
+
+    /*
+     * Build
+     */
+
+    /** Build. */
+    CompressedGraph build();
+
+private:
+
+    /*
+     * Private attributes
+     */
+
+    /** Graph. */
+    CompressedGraph graph_;
+
+    /** Sum of the degrees of the vertices. */
+    EdgeId sum_of_degrees_ = 0;
+
+    /** Vector used to sort the neighbors of a vertex. */
+    std::vector<VertexId> neighbors_tmp_;
+
+};
+
+}
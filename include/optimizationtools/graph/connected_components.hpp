@@ -0,0 +1,55 @@
+#pragma once
+
+#include "optimizationtools/graph/adjacency_list_graph.hpp"
+
+#include <vector>
+
+namespace optimizationtools
+{
+
+/**
+ * Compute the connected components of a graph.
+ *
+ * Return, for each vertex, the id of its connected component. The
+ * components are numbered by increasing smallest vertex id. Therefore, the
+ * result doesn't depend on the number of threads.
+ *
+ * The components are computed with a lock-free union-find in which a root is
+ * always linked to a smaller root (Afforest): each thread first links the
+ * vertices of its range to their first two neighbors, then the largest
+ * component is identified by sampling, and only the vertices outside of it
+ * process their remaining neighbors. The threads are started once, and the
+ * steps are separated by a barrier.
+ */
+std::vector<ComponentId> connected_components(
+        const AdjacencyListGraph& graph,
+        int number_of_threads = 1);
+
+/**
+ * Get the vertices of each connected component of a graph, by increasing
+ * vertex id.
+ *
+ * The components must have been computed by
+ * 'AdjacencyListGraphBuilder::build'.
+ */
+std::vector<std::vector<VertexId>> connected_components_vertices(
+        const AdjacencyListGraph& graph);
+
+/**
+ * Build the subgraph induced by a connected component.
+ *
+ * 'component_vertices' contains the vertices of the component by increasing
+ * vertex id, as returned by 'connected_components_vertices'. Vertex 'i' of
+ * the subgraph is vertex 'component_vertices[i]' of the graph.
+ *
+ * The subgraph is built by 'induced_subgraph', which finds the ids of the
+ * neighbors by dichotomy. This requires a time O(m_c log n_c), where n_c and
+ * m_c are the numbers of vertices and edges of the component, and no array
+ * of size 'graph.number_of_vertices()', so the components of a graph can be
+ * extracted and solved in parallel.
+ */
+AdjacencyListGraph connected_component_subgraph(
+        const AdjacencyListGraph& graph,
+        const std::vector<VertexId>& component_vertices);
+
+}
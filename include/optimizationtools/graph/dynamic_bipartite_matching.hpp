@@ -0,0 +1,213 @@
+#pragma once
+
+#include "optimizationtools/graph/dynamic_graph.hpp"
+
+#include <vector>
+
+namespace optimizationtools
+{
+
+/**
+ * Maximum matching of a bipartite graph maintained under edge insertions and
+ * deletions.
+ *
+ * The initial matching is computed with 'BipartiteGraph'. After an update,
+ * the matching is repaired with augmenting path searches starting only from
+ * the ends of the updated edge:
+ * - Inserting an edge increases the size of a maximum matching by at most
+ *   one, and an augmenting path then contains the new edge. If an end of the
+ *   new edge is free, the path starts there. If both ends 'u' and 'v' are
+ *   matched, the path goes through the matched edge of 'u'; the alternating
+ *   path from 'u' through its matched edge to a free vertex, if any, is
+ *   flipped, which frees 'u' without changing the size of the matching, and
+ *   the path is then searched from 'u'.
+ * - Deleting an unmatched edge keeps the matching maximum. Deleting a
+ *   matched edge frees its two ends; an augmenting path, if any, starts at
+ *   one of them.
+ *
+ * Each search is a breadth first search over alternating paths; its visited
+ * vertices are marked with a search id, so that its cost only depends on
+ * the part of the graph it explores. A search is skipped when the side on
+ * which it would end has no free vertex, which is the common case when a
+ * side is perfectly matched. Otherwise, a search which doesn't find an
+ * augmenting path explores all the vertices reachable by alternating paths
+ * from its root, which can be most of the graph.
+ *
+ * The edge ids are the ids of the underlying DynamicGraph; they are kept
+ * from the initial graph and not reused after a deletion.
+ */
+class DynamicBipartiteMatching
+{
+
+public:
+
+    /*
+     * Constructors and destructor
+     */
+
+    /**
+     * Create a matching for a bipartite graph, computing the sides of its
+     * vertices.
+     *
+     * Throw an 'std::invalid_argument' exception if the graph is not
+     * bipartite.
+     */
+    DynamicBipartiteMatching(const AdjacencyListGraph& graph);
+
+    /** Create a matching for a bipartite graph with precomputed sides. */
+    DynamicBipartiteMatching(
+            const AdjacencyListGraph& graph,
+            const std::vector<uint8_t>& vertices_sides);
+
+    /**
+     * Create an empty matching for a graph without edges, given the side of
+     * each vertex.
+     */
+    DynamicBipartiteMatching(const std::vector<uint8_t>& vertices_sides);
+
+    /*
+     * Getters
+     */
+
+    /** Get the graph. */
+    inline const DynamicGraph& graph() const { return graph_; }
+
+    /** Get the side of a vertex. */
+    inline uint8_t side(VertexId vertex_id) const { return vertices_sides_[vertex_id]; }
+
+    /** Get the size of the matching. */
+    inline EdgeId matching_size() const { return matching_size_; }
+
+    /** Get the matched edge of a vertex, '-1' if the vertex is not matched. */
+    inline EdgeId matched_edge(VertexId vertex_id) const { return vertices_matched_edge_[vertex_id]; }
+
+    /** Get the mate of a vertex, '-1' if the vertex is not matched. */
+    inline VertexId mate(VertexId vertex_id) const
+    {
+        EdgeId edge_id = vertices_matched_edge_[vertex_id];
+        return (edge_id == -1)? -1: graph_.other_end(edge_id, vertex_id);
+    }
+
+    /** Return 'true' iff an edge belongs to the matching. */
+    inline bool is_matched(EdgeId edge_id) const
+    {
+        return graph_.contains_edge(edge_id)
+            && vertices_matched_edge_[graph_.edge(edge_id).vertex_1_id] == edge_id;
+    }
+
+    /**
+     * Get the matching, as returned by 'bipartite_graph_maximum_matching':
+     * for each edge id, '1' if the edge belongs to the matching, '0'
+     * otherwise.
+     */
+    std::vector<uint8_t> maximum_matching() const;
+
+    /**
+     * Get the total number of vertices visited by the augmenting path
+     * searches since the construction.
+     */
+    inline VertexId number_of_visited_vertices() const { return number_of_visited_vertices_; }
+
+    /*
+     * Setters
+     */
+
+    /**
+     * Add an edge between two vertices of different sides and repair the
+     * matching.
+     *
+     * Return the id of the new edge.
+     */
+    EdgeId add_edge(
+            VertexId vertex_id_1,
+            VertexId vertex_id_2);
+
+    /** Remove an edge and repair the matching. */
+    void remove_edge(EdgeId edge_id);
+
+private:
+
+    /*
+     * Private methods
+     */
+
+    /** Check the sides and compute the initial matching. */
+    void initialize(const AdjacencyListGraph& graph);
+
+    /**
+     * Look for an augmenting path from a free vertex and flip it.
+     *
+     * 'blocked_vertex_id', if not '-1', is not visited by the search.
+     *
+     * Return 'true' iff such a path has been found.
+     */
+    bool augment(
+            VertexId root_id,
+            VertexId blocked_vertex_id = -1);
+
+    /** Match an edge whose ends are free. */
+    inline void match(EdgeId edge_id);
+
+    /** Unmatch a matched edge. */
+    inline void unmatch(EdgeId edge_id);
+
+    /*
+     * Private attributes
+     */
+
+    /** Graph. */
+    DynamicGraph graph_;
+
+    /** Side of each vertex. */
+    std::vector<uint8_t> vertices_sides_;
+
+    /** For each vertex, its matched edge, '-1' if it is not matched. */
+    std::vector<EdgeId> vertices_matched_edge_;
+
+    /** Number of vertices of each side. */
+    VertexId sides_number_of_vertices_[2] = {0, 0};
+
+    /** Size of the matching. */
+    EdgeId matching_size_ = 0;
+
+    /** For each vertex, the id of the last search which visited it. */
+    std::vector<Counter> vertices_search_ids_;
+
+    /** Id of the current search. */
+    Counter search_id_ = 0;
+
+    /**
+     * For each vertex of the side of the root visited by the current search,
+     * the unmatched edge through which its mate has been reached.
+     */
+    std::vector<EdgeId> vertices_pred_edge_;
+
+    /** Queue of the current search. */
+    std::vector<VertexId> queue_;
+
+    /** Total number of vertices visited by the searches. */
+    VertexId number_of_visited_vertices_ = 0;
+
+};
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+inline void DynamicBipartiteMatching::match(EdgeId edge_id)
+{
+    const DynamicGraph::Edge& edge = graph_.edge(edge_id);
+    vertices_matched_edge_[edge.vertex_1_id] = edge_id;
+    vertices_matched_edge_[edge.vertex_2_id] = edge_id;
+    matching_size_++;
+}
+
+inline void DynamicBipartiteMatching::unmatch(EdgeId edge_id)
+{
+    const DynamicGraph::Edge& edge = graph_.edge(edge_id);
+    vertices_matched_edge_[edge.vertex_1_id] = -1;
+    vertices_matched_edge_[edge.vertex_2_id] = -1;
+    matching_size_--;
+}
+
+}
@@ -0,0 +1,285 @@
+#pragma once
+
+#include "optimizationtools/graph/adjacency_list_graph.hpp"
+
+#include "optimizationtools/containers/indexed_set.hpp"
+
+#include <vector>
+
+namespace optimizationtools
+{
+
+/**
+ * Mutable graph supporting edge insertion, edge deletion and vertex removal.
+ *
+ * The set of vertex ids is fixed at construction. Removing a vertex removes
+ * its incident edges; the vertex then stays as an isolated inactive vertex.
+ *
+ * Each edge stores its position in the adjacency lists of its two ends.
+ * Removing an edge moves the last element of each adjacency list at the
+ * position of the removed element and updates the position stored in the
+ * moved edge, in O(1). Therefore, the order of the neighbors of a vertex
+ * changes when edges are removed.
+ *
+ * The ids of the removed edges are not reused. 'compact' returns a static
+ * graph with the active vertices and edges, numbered contiguously.
+ */
+class DynamicGraph
+{
+
+public:
+
+    /*
+     * Structures
+     */
+
+    /**
+     * Structure that stores the information for an edge incident to a vertex.
+     */
+    struct VertexEdge
+    {
+        /** Id of the edge. */
+        EdgeId edge_id;
+
+        /** Id of the neighbor. */
+        VertexId vertex_id;
+    };
+
+    /**
+     * Structure that stores the information for an edge.
+     */
+    struct Edge
+    {
+        /** First end of the edge, '-1' if the edge has been removed. */
+        VertexId vertex_1_id;
+
+        /** Second end of the edge. */
+        VertexId vertex_2_id;
+
+        /** Position of the edge in the adjacency list of its first end. */
+        VertexPos vertex_1_position;
+
+        /** Position of the edge in the adjacency list of its second end. */
+        VertexPos vertex_2_position;
+    };
+
+    /*
+     * Constructors and destructor
+     */
+
+    /** Create a graph with 'number_of_vertices' vertices and no edges. */
+    DynamicGraph(VertexId number_of_vertices);
+
+    /**
+     * Create a graph from an AdjacencyListGraph.
+     *
+     * The vertex and edge ids are kept.
+     */
+    DynamicGraph(const AdjacencyListGraph& graph);
+
+    /*
+     * Getters
+     */
+
+    /**
+     * Get the number of vertices, including the removed ones.
+     *
+     * The removed vertices are isolated, so the algorithms templated on the
+     * graph type can be used directly on a dynamic graph.
+     */
+    inline VertexId number_of_vertices() const { return vertices_.size(); }
+
+    /** Get the set of the vertices which have not been removed. */
+    inline const IndexedSet& active_vertices() const { return active_vertices_; }
+
+    /** Return 'true' iff a vertex has not been removed. */
+    inline bool contains(VertexId vertex_id) const { return active_vertices_.contains(vertex_id); }
+
+    /** Get the number of edges which have not been removed. */
+    inline EdgeId number_of_edges() const { return number_of_edges_; }
+
+    /** Get the number of edge ids, including the removed edges. */
+    inline EdgeId number_of_edge_ids() const { return edges_.size(); }
+
+    /** Return 'true' iff an edge has not been removed. */
+    inline bool contains_edge(EdgeId edge_id) const { return edges_[edge_id].vertex_1_id != -1; }
+
+    /** Get an edge. */
+    inline const Edge& edge(EdgeId edge_id) const { return edges_[edge_id]; }
+
+    /** Get the other end of an edge. */
+    inline VertexId other_end(
+            EdgeId edge_id,
+            VertexId vertex_id) const
+    {
+        return (vertex_id == edges_[edge_id].vertex_1_id)?
+            edges_[edge_id].vertex_2_id:
+            edges_[edge_id].vertex_1_id;
+    }
+
+    /** Get the degree of a vertex. */
+    inline VertexPos degree(VertexId vertex_id) const { return vertices_[vertex_id].edges.size(); }
+
+    /** Get the weight of a vertex. */
+    inline Weight weight(VertexId vertex_id) const { return vertices_[vertex_id].weight; }
+
+    /** Get the total weight of the vertices which have not been removed. */
+    inline Weight total_weight() const { return total_weight_; }
+
+    /** Get the list of edges incident to a vertex. */
+    inline const std::vector<VertexEdge>& edges(VertexId vertex_id) const { return vertices_[vertex_id].edges; }
+
+    /** Call 'function(neighbor_id)' for each neighbor of a vertex. */
+    template <typename Function>
+    inline void for_each_neighbor(
+            VertexId vertex_id,
+            Function function) const
+    {
+        for (const VertexEdge& vertex_edge: vertices_[vertex_id].edges)
+            function(vertex_edge.vertex_id);
+    }
+
+    /**
+     * Return the id of an edge between two vertices, '-1' if there is none.
+     *
+     * This requires a time linear in the smallest degree of the two vertices.
+     */
+    EdgeId find_edge(
+            VertexId vertex_id_1,
+            VertexId vertex_id_2) const;
+
+    /** Return 'true' iff two vertices are adjacent. */
+    inline bool has_edge(
+            VertexId vertex_id_1,
+            VertexId vertex_id_2) const
+    {
+        return find_edge(vertex_id_1, vertex_id_2) != -1;
+    }
+
+    /*
+     * Setters
+     */
+
+    /** Set the weight of a vertex. */
+    inline void set_weight(
+            VertexId vertex_id,
+            Weight weight)
+    {
+        if (contains(vertex_id))
+            total_weight_ += weight - vertices_[vertex_id].weight;
+        vertices_[vertex_id].weight = weight;
+    }
+
+    /**
+     * Add an edge between two vertices which have not been removed.
+     *
+     * Return the id of the new edge, or '-1' for a self-loop.
+     */
+    EdgeId add_edge(
+            VertexId vertex_id_1,
+            VertexId vertex_id_2);
+
+    /** Remove an edge in O(1). */
+    inline void remove_edge(EdgeId edge_id);
+
+    /** Remove a vertex and its incident edges. */
+    void remove_vertex(VertexId vertex_id);
+
+    /*
+     * Export
+     */
+
+    /**
+     * Build a static graph with the vertices and edges which have not been
+     * removed.
+     *
+     * Vertex 'i' of the returned graph is vertex 'original_vertex_ids[i]' of
+     * the dynamic graph. The vertices are numbered by increasing id.
+     */
+    AdjacencyListGraph compact(
+            std::vector<VertexId>& original_vertex_ids) const;
+
+private:
+
+    /*
+     * Private structures
+     */
+
+    struct Vertex
+    {
+        /** Weight of the vertex. */
+        Weight weight = 1;
+
+        /** Edges incident to the vertex. */
+        std::vector<VertexEdge> edges;
+    };
+
+    /*
+     * Private attributes
+     */
+
+    /** Vertices. */
+    std::vector<Vertex> vertices_;
+
+    /** Edges. */
+    std::vector<Edge> edges_;
+
+    /** Vertices which have not been removed. */
+    IndexedSet active_vertices_;
+
+    /** Number of edges which have not been removed. */
+    EdgeId number_of_edges_ = 0;
+
+    /** Total weight of the vertices which have not been removed. */
+    Weight total_weight_ = 0;
+
+    /*
+     * Private methods
+     */
+
+    /**
+     * Remove the element at a given position of the adjacency list of a
+     * vertex.
+     */
+    inline void remove_vertex_edge(
+            VertexId vertex_id,
+            VertexPos position);
+
+};
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+inline void DynamicGraph::remove_vertex_edge(
+        VertexId vertex_id,
+        VertexPos position)
+{
+    std::vector<VertexEdge>& vertex_edges = vertices_[vertex_id].edges;
+    const VertexEdge& vertex_edge_last = vertex_edges.back();
+    if (position != (VertexPos)vertex_edges.size() - 1) {
+        // Update the position stored in the moved edge.
+        Edge& edge_last = edges_[vertex_edge_last.edge_id];
+        if (edge_last.vertex_1_id == vertex_id) {
+            edge_last.vertex_1_position = position;
+        } else {
+            edge_last.vertex_2_position = position;
+        }
+        vertex_edges[position] = vertex_edge_last;
+    }
+    vertex_edges.pop_back();
+}
+
+inline void DynamicGraph::remove_edge(EdgeId edge_id)
+{
+    Edge& edge = edges_[edge_id];
+    if (edge.vertex_1_id == -1)
+        return;
+    remove_vertex_edge(edge.vertex_1_id, edge.vertex_1_position);
+    remove_vertex_edge(edge.vertex_2_id, edge.vertex_2_position);
+    edge.vertex_1_id = -1;
+    edge.vertex_2_id = -1;
+    number_of_edges_--;
+}
+
+}
@@ -0,0 +1,287 @@
+#pragma once
+
+#include "optimizationtools/graph/abstract_graph.hpp"
+
+#include "optimizationtools/utils/utils.hpp"
+
+#include <fstream>
+#include <sstream>
+#include <cstring>
+
+namespace optimizationtools
+{
+
+/** Header of the files in 'binary' format. */
+const char graph_binary_format_header[8] = {'O', 'T', 'G', 'R', 'A', 'P', 'H', '1'};
+
+/**
+ * Read a graph from a file and send its vertices and edges to a builder.
+ *
+ * The file is parsed in a single pass and the edges are sent one by one, so
+ * the builder decides how they are stored.
+ *
+ * 'GraphBuilder' must provide the methods:
+ * - 'VertexId number_of_vertices() const'
+ * - 'VertexId add_vertex(Weight weight)'
+ * - 'void set_weight(VertexId vertex_id, Weight weight)'
+ * - 'EdgeId add_edge(VertexId vertex_1_id, VertexId vertex_2_id)'
+ * - 'void reserve(VertexId number_of_vertices, EdgeId number_of_edges)'
+ *
+ * Available formats: 'dimacs' or 'dimacs1992', 'dimacs2010',
+ * 'matrixmarket', 'snap', 'chaco' and 'binary'.
+ */
+template <typename GraphBuilder>
+void read_graph(
+        const std::string& instance_path,
+        const std::string& format,
+        GraphBuilder& graph_builder);
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename GraphBuilder>
+void read_graph_dimacs1992(
+        std::ifstream& file,
+        GraphBuilder& graph_builder)
+{
+    std::string tmp;
+    std::vector<std::string> line;
+
+    while (getline(file, tmp)) {
+        line = optimizationtools::split(tmp, ' ');
+        if (line.size() == 0) {
+        } else if (line[0] == "c") {
+        } else if (line[0] == "p") {
+            VertexId number_of_vertices = stol(line[2]);
+            for (VertexId vertex_id = 0;
+                    vertex_id < number_of_vertices;
+                    ++vertex_id) {
+                graph_builder.add_vertex(1);
+            }
+        } else if (line[0] == "n") {
+            VertexId vertex_id = stol(line[1]) - 1;
+            Weight weight = stol(line[2]);
+            graph_builder.set_weight(vertex_id, weight);
+        } else if (line[0] == "e") {
+            VertexId vertex_1_id = stol(line[1]) - 1;
+            VertexId vertex_2_id = stol(line[2]) - 1;
+            graph_builder.add_edge(vertex_1_id, vertex_2_id);
+        }
+    }
+}
+
+template <typename GraphBuilder>
+void read_graph_dimacs2010(
+        std::ifstream& file,
+        GraphBuilder& graph_builder)
+{
+    std::string tmp;
+    std::vector<std::string> line;
+    bool first = true;
+    VertexId vertex_id = -1;
+    while (vertex_id != graph_builder.number_of_vertices()) {
+        getline(file, tmp);
+        line = optimizationtools::split(tmp, ' ');
+        if (tmp[0] == '%')
+            continue;
+        if (first) {
+            VertexId number_of_vertices = stol(line[0]);
+            for (VertexId vertex_id = 0;
+                    vertex_id < number_of_vertices;
+                    ++vertex_id) {
+                graph_builder.add_vertex(1);
+            }
+            first = false;
+            vertex_id = 0;
+        } else {
+            for (const std::string& str: line) {
+                VertexId vertex_2_id = stol(str) - 1;
+                if (vertex_2_id > vertex_id)
+                    graph_builder.add_edge(vertex_id, vertex_2_id);
+            }
+            vertex_id++;
+        }
+    }
+}
+
+template <typename GraphBuilder>
+void read_graph_matrixmarket(
+        std::ifstream& file,
+        GraphBuilder& graph_builder)
+{
+    std::string tmp;
+    do {
+        getline(file, tmp);
+    } while (tmp[0] == '%');
+    std::stringstream ss(tmp);
+    VertexId number_of_vertices = -1;
+    ss >> number_of_vertices;
+    for (VertexId vertex_id = 0;
+            vertex_id < number_of_vertices;
+            ++vertex_id) {
+        graph_builder.add_vertex(1);
+    }
+
+    VertexId vertex_1_id = -1;
+    VertexId vertex_2_id = -1;
+    while (getline(file, tmp)) {
+        std::stringstream ss(tmp);
+        ss >> vertex_1_id >> vertex_2_id;
+        graph_builder.add_edge(vertex_1_id - 1, vertex_2_id - 1);
+    }
+}
+
+template <typename GraphBuilder>
+void read_graph_chaco(
+        std::ifstream& file,
+        GraphBuilder& graph_builder)
+{
+    std::string tmp;
+    std::vector<std::string> line;
+
+    getline(file, tmp);
+    line = optimizationtools::split(tmp, ' ');
+    VertexId number_of_vertices = stol(line[0]);
+    for (VertexId vertex_id = 0;
+            vertex_id < number_of_vertices;
+            ++vertex_id) {
+        graph_builder.add_vertex(1);
+    }
+
+    for (VertexId vertex_id = 0;
+            vertex_id < number_of_vertices;
+            ++vertex_id) {
+        getline(file, tmp);
+        line = optimizationtools::split(tmp, ' ');
+        for (std::string str: line) {
+            VertexId vertex_2_id = stol(str) - 1;
+            if (vertex_2_id > vertex_id)
+                graph_builder.add_edge(vertex_id, vertex_2_id);
+        }
+    }
+}
+
+template <typename GraphBuilder>
+void read_graph_snap(
+        std::ifstream& file,
+        GraphBuilder& graph_builder)
+{
+    std::string tmp;
+    do {
+        getline(file, tmp);
+    } while (tmp[0] == '#');
+
+    VertexId vertex_1_id = -1;
+    VertexId vertex_2_id = -1;
+    for (;;) {
+        file >> vertex_1_id >> vertex_2_id;
+        if (file.eof())
+            break;
+        while ((std::max)(vertex_1_id, vertex_2_id) >= graph_builder.number_of_vertices())
+            graph_builder.add_vertex(1);
+        graph_builder.add_edge(vertex_1_id, vertex_2_id);
+    }
+}
+
+template <typename GraphBuilder>
+void read_graph_binary(
+        std::ifstream& file,
+        GraphBuilder& graph_builder)
+{
+    char header[8];
+    file.read(header, sizeof(header));
+    if (!file.good() || std::memcmp(header, graph_binary_format_header, sizeof(header)) != 0) {
+        throw std::runtime_error(
+                "Invalid header for format \"binary\".");
+    }
+
+    int64_t number_of_vertices = 0;
+    int64_t number_of_edges = 0;
+    file.read(reinterpret_cast<char*>(&number_of_vertices), sizeof(number_of_vertices));
+    file.read(reinterpret_cast<char*>(&number_of_edges), sizeof(number_of_edges));
+    if (!file.good()) {
+        throw std::runtime_error(
+                "Unexpected end of file for format \"binary\".");
+    }
+
+    // Check the header against the size of the file before allocating.
+    std::streamoff position = file.tellg();
+    file.seekg(0, std::ios::end);
+    int64_t number_of_remaining_bytes = file.tellg() - position;
+    file.seekg(position);
+    if (number_of_vertices < 0
+            || number_of_edges < 0
+            || number_of_vertices > number_of_remaining_bytes / (int64_t)sizeof(Weight)
+            || number_of_edges != (number_of_remaining_bytes - number_of_vertices * (int64_t)sizeof(Weight))
+                / (int64_t)(2 * sizeof(VertexId))
+            || number_of_remaining_bytes != number_of_vertices * (int64_t)sizeof(Weight)
+                + number_of_edges * (int64_t)(2 * sizeof(VertexId))) {
+        throw std::runtime_error(
+                "Invalid numbers of vertices and edges for format \"binary\"; "
+                "number_of_vertices: " + std::to_string(number_of_vertices) + "; "
+                "number_of_edges: " + std::to_string(number_of_edges) + "; "
+                "file size after the header: " + std::to_string(number_of_remaining_bytes) + ".");
+    }
+    graph_builder.reserve(
+            graph_builder.number_of_vertices() + number_of_vertices,
+            number_of_edges);
+
+    std::vector<Weight> weights(number_of_vertices);
+    file.read(reinterpret_cast<char*>(weights.data()), number_of_vertices * sizeof(Weight));
+    for (VertexId vertex_id = 0;
+            vertex_id < number_of_vertices;
+            ++vertex_id) {
+        graph_builder.add_vertex(weights[vertex_id]);
+    }
+
+    const EdgeId chunk_size = 1 << 16;
+    std::vector<VertexId> ends(2 * chunk_size);
+    for (EdgeId edge_id_start = 0;
+            edge_id_start < number_of_edges;
+            edge_id_start += chunk_size) {
+        EdgeId edge_id_end = (std::min)(edge_id_start + chunk_size, number_of_edges);
+        file.read(
+                reinterpret_cast<char*>(ends.data()),
+                2 * (edge_id_end - edge_id_start) * sizeof(VertexId));
+        for (EdgeId edge_pos = 0; edge_pos < edge_id_end - edge_id_start; ++edge_pos)
+            graph_builder.add_edge(ends[2 * edge_pos], ends[2 * edge_pos + 1]);
+    }
+    if (!file.good()) {
+        throw std::runtime_error(
+                "Unexpected end of file for format \"binary\".");
+    }
+}
+
+template <typename GraphBuilder>
+void read_graph(
+        const std::string& instance_path,
+        const std::string& format,
+        GraphBuilder& graph_builder)
+{
+    std::ifstream file(
+            instance_path,
+            (format == "binary")? std::ios::in | std::ios::binary: std::ios::in);
+    if (!file.good())
+        throw std::runtime_error(
+                "Unable to open file \"" + instance_path + "\".");
+
+    if (format == "dimacs" || format == "dimacs1992") {
+        read_graph_dimacs1992(file, graph_builder);
+    } else if (format == "dimacs2010") {
+        read_graph_dimacs2010(file, graph_builder);
+    } else if (format == "matrixmarket") {
+        read_graph_matrixmarket(file, graph_builder);
+    } else if (format == "snap") {
+        read_graph_snap(file, graph_builder);
+    } else if (format == "chaco") {
+        read_graph_chaco(file, graph_builder);
+    } else if (format == "binary") {
+        read_graph_binary(file, graph_builder);
+    } else {
+        throw std::invalid_argument(
+                "Unknown instance format \"" + format + "\".");
+    }
+}
+
+}
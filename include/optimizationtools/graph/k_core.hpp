@@ -0,0 +1,73 @@
+#pragma once
+
+#include "optimizationtools/graph/adjacency_list_graph.hpp"
+
+#include <vector>
+
+namespace optimizationtools
+{
+
+/*
+ * k-core decomposition.
+ *
+ * The k-core of a graph is its largest induced subgraph in which every vertex
+ * has degree at least k. The core number of a vertex is the largest k such
+ * that the vertex belongs to the k-core. The degeneracy of the graph is the
+ * largest core number.
+ *
+ * A vertex of a clique of size k + 1 has k neighbors in the clique, so it
+ * belongs to the k-core. Therefore, a vertex whose core number is smaller
+ * than k doesn't belong to any clique of size k + 1, and the size of a
+ * clique is at most the degeneracy plus one.
+ */
+
+/**
+ * Structure storing the k-core decomposition of a graph.
+ */
+struct CoreDecomposition
+{
+    /** For each vertex, its core number. */
+    std::vector<VertexPos> core_numbers;
+
+    /**
+     * Degeneracy ordering: the vertices in an order in which they can be
+     * removed such that each removed vertex has a minimum degree in the
+     * remaining graph. Each vertex has at most its core number neighbors
+     * after it in the ordering.
+     */
+    std::vector<VertexId> ordering;
+
+    /** Degeneracy of the graph. */
+    VertexPos degeneracy = 0;
+};
+
+/**
+ * Compute the k-core decomposition of a graph.
+ *
+ * If 'number_of_threads' is 1, the bucket algorithm of Batagelj and
+ * Zaversnik is used, in O(n + m).
+ *
+ * Otherwise, the vertices are peeled level by level: at level k, the
+ * vertices of degree at most k are removed in rounds; the degrees of their
+ * neighbors are decremented atomically, and the neighbors whose degree
+ * reaches k are removed at the next round. The vertices of a round are
+ * processed in parallel by threads started once, which wait at a barrier
+ * between the rounds. Each level starts with a scan of the remaining
+ * vertices, whose list is compacted during the scan; a level at which no
+ * vertex is removed is followed directly by the smallest remaining degree.
+ * The core numbers are the same as with the sequential algorithm; the
+ * ordering contains the vertices by level, then by round, then by id, so it
+ * doesn't depend on the number of threads.
+ */
+CoreDecomposition core_decomposition(
+        const AdjacencyListGraph& graph,
+        int number_of_threads = 1);
+
+/**
+ * Get the vertices of the k-core of a graph, by increasing id.
+ */
+std::vector<VertexId> k_core_vertices(
+        const CoreDecomposition& core_decomposition,
+        VertexPos k);
+
+}
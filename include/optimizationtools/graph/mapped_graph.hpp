@@ -0,0 +1,337 @@
+#pragma once
+
+#include "optimizationtools/graph/abstract_graph.hpp"
+
+#include <cstdint>
+#include <vector>
+#include <string>
+#include <utility>
+
+namespace optimizationtools
+{
+
+/**
+ * Read-only graph stored in a file in compressed sparse row format.
+ *
+ * The file contains, after an 8-byte header "OTCSR001", as 64-bit values in
+ * the native byte order:
+ * - the number of vertices 'n'
+ * - the number of arcs, i.e. twice the number of edges
+ * - the 'n' weights of the vertices
+ * - the 'n + 1' positions of the first neighbor of each vertex in the array
+ *   of neighbors, the last one being the number of arcs
+ * - the neighbors of each vertex, sorted
+ *
+ * Such a file is written by 'ExternalMemoryGraphBuilder::build'.
+ *
+ * When the file is opened, its sizes, offsets and neighbor ids are checked,
+ * which requires a sequential scan of the file.
+ *
+ * On POSIX systems, the file is mapped in memory, so that the graph can be
+ * larger than the available memory: the operating system loads the pages of
+ * the file when they are accessed and evicts them when needed. On other
+ * systems, the file is read in memory.
+ */
+class MappedGraph: public AbstractGraph
+{
+
+public:
+
+    /*
+     * Constructors and destructor
+     */
+
+    /** Open a graph file. */
+    MappedGraph(const std::string& path);
+
+    /** Copy constructor; the file is opened again. */
+    MappedGraph(const MappedGraph& graph): MappedGraph(graph.path_) { }
+
+    /** Move constructor. */
+    MappedGraph(MappedGraph&& graph);
+
+    MappedGraph& operator=(const MappedGraph&) = delete;
+
+    /** Destructor. */
+    virtual ~MappedGraph();
+
+    virtual MappedGraph* clone() const override
+    {
+        return new MappedGraph(*this);
+    }
+
+    /*
+     * Getters
+     */
+
+    /** Get the path of the file. */
+    inline const std::string& path() const { return path_; }
+
+    /** Return 'true' iff the file is mapped in memory. */
+    inline bool is_mapped() const { return mapping_.data != nullptr; }
+
+    inline VertexPos number_of_vertices() const override final { return number_of_vertices_; }
+
+    inline EdgeId number_of_edges() const override final { return number_of_arcs_ / 2; }
+
+    inline VertexPos degree(VertexId vertex_id) const override final { return offsets_[vertex_id + 1] - offsets_[vertex_id]; }
+
+    inline VertexPos highest_degree() const override final { return highest_degree_; }
+
+    inline Weight weight(VertexId vertex_id) const override final { return weights_[vertex_id]; }
+
+    inline Weight total_weight() const override final { return total_weight_; }
+
+    /**
+     * Returns an iterator pointing to the first element in the neighbors of
+     * vertex 'v'.
+     *
+     * The neighbors are copied in a vector shared by all calls. Use
+     * 'neighbors' or 'for_each_neighbor' instead.
+     */
+    virtual const_iterator neighbors_begin(VertexId vertex_id) const override final
+    {
+        neighbors_tmp_.assign(
+                neighbors_ + offsets_[vertex_id],
+                neighbors_ + offsets_[vertex_id + 1]);
+        return neighbors_tmp_.begin();
+    }
+
+    virtual const_iterator neighbors_end(VertexId) const override final
+    {
+        return neighbors_tmp_.end();
+    }
+
+    virtual const std::vector<VertexId>& neighbors(
+            VertexId vertex_id,
+            std::vector<VertexId>& neighbors) const override final
+    {
+        neighbors.assign(
+                neighbors_ + offsets_[vertex_id],
+                neighbors_ + offsets_[vertex_id + 1]);
+        return neighbors;
+    }
+
+    /** Call 'function(neighbor_id)' for each neighbor of a vertex. */
+    template <typename Function>
+    inline void for_each_neighbor(
+            VertexId vertex_id,
+            Function function) const
+    {
+        for (const VertexId* it = neighbors_ + offsets_[vertex_id];
+                it != neighbors_ + offsets_[vertex_id + 1];
+                ++it) {
+            function(*it);
+        }
+    }
+
+private:
+
+    /*
+     * Private structures
+     */
+
+    /**
+     * Mapping of a file in memory, unmapped by its destructor, so that it is
+     * also released when the constructor of the graph throws.
+     */
+    struct FileMapping
+    {
+        /** Start of the mapping; 'nullptr' if the file is not mapped. */
+        void* data = nullptr;
+
+        /** Size of the mapping. */
+        std::size_t size = 0;
+
+        FileMapping() { }
+
+        FileMapping(FileMapping&& mapping):
+            data(mapping.data),
+            size(mapping.size)
+        {
+            mapping.data = nullptr;
+        }
+
+        FileMapping(const FileMapping&) = delete;
+
+        FileMapping& operator=(const FileMapping&) = delete;
+
+        ~FileMapping();
+    };
+
+    /*
+     * Private attributes
+     */
+
+    /** Path of the file. */
+    std::string path_;
+
+    /** Mapping of the file. */
+    FileMapping mapping_;
+
+    /** Size of the file. */
+    std::size_t size_ = 0;
+
+    /** Content of the file if it is not mapped. */
+    std::vector<char> content_;
+
+    /** Number of vertices. */
+    VertexId number_of_vertices_ = 0;
+
+    /** Number of arcs. */
+    EdgeId number_of_arcs_ = 0;
+
+    /** Weights of the vertices, in the file. */
+    const Weight* weights_ = nullptr;
+
+    /** Positions of the first neighbor of each vertex, in the file. */
+    const EdgeId* offsets_ = nullptr;
+
+    /** Neighbors, in the file. */
+    const VertexId* neighbors_ = nullptr;
+
+    /** Maximum degree. */
+    VertexPos highest_degree_ = 0;
+
+    /** Total weight. */
+    Weight total_weight_ = 0;
+
+    /** Vector filled and returned by the 'neighbors_begin' method. */
+    mutable std::vector<VertexId> neighbors_tmp_;
+
+};
+
+/**
+ * Builder of a graph which doesn't fit in memory.
+ *
+ * The edges are buffered in memory as arcs in both directions. When the
+ * buffer is full, it is sorted and written to a temporary file, called a
+ * run. 'build' merges the sorted runs into a MappedGraph file. Only the
+ * buffer, the weights of the vertices and one block per run during the
+ * merge are kept in memory.
+ *
+ * A merge keeps a file open per run. If there are more runs than
+ * 'maximum_number_of_merged_runs', they are first merged by groups into
+ * larger runs, in as many passes as needed, each pass reading and writing
+ * all the arcs once.
+ *
+ * Graphs in any format supported by 'read_graph' can be streamed into the
+ * builder with 'read'.
+ */
+class ExternalMemoryGraphBuilder
+{
+
+public:
+
+    /**
+     * Constructor.
+     *
+     * The runs are written in files named
+     * 'temporary_path_prefix + "run_" + run_id'.
+     *
+     * 'buffer_size' is the number of arcs kept in memory; each arc takes 16
+     * bytes. A graph with 'm' edges is written in '2 m / buffer_size' runs,
+     * for example about 1200 runs for 10 billion edges with the default
+     * size.
+     *
+     * 'maximum_number_of_merged_runs' is the maximum number of runs merged
+     * at once, i.e. of files open at the same time; it must stay below the
+     * limit on open files of the process (often 1024). Each merged run
+     * also takes a block of 1 MB of memory during the merge.
+     */
+    ExternalMemoryGraphBuilder(
+            const std::string& temporary_path_prefix,
+            EdgeId buffer_size = 1 << 24,
+            EdgeId maximum_number_of_merged_runs = 256);
+
+    /** Destructor; removes the remaining runs. */
+    ~ExternalMemoryGraphBuilder();
+
+    /** Read a graph from a file (see 'read_graph'). */
+    void read(
+            const std::string& instance_path,
+            const std::string& format);
+
+    /** Get the number of vertices added so far. */
+    inline VertexId number_of_vertices() const { return weights_.size(); }
+
+    /** Reserve memory for a given number of vertices. */
+    void reserve(
+            VertexId number_of_vertices,
+            EdgeId number_of_edges);
+
+    /** Add a vertex. */
+    VertexId add_vertex(Weight weight = 1);
+
+    /** Set the weight of a vertex. */
+    void set_weight(
+            VertexId vertex_id,
+            Weight weight);
+
+    /**
+     * Add an edge.
+     *
+     * Return the id of the new edge, or '-1' for a self-loop. Throw a
+     * 'std::invalid_argument' if an end is not a vertex already added.
+     */
+    EdgeId add_edge(
+            VertexId vertex_1_id,
+            VertexId vertex_2_id);
+
+    /*
+     * Build
+     */
+
+    /**
+     * Merge the runs into a file in the format of MappedGraph and open it.
+     *
+     * If 'remove_duplicate_edges' is 'true', the duplicate edges are skipped
+     * during the merge.
+     */
+    MappedGraph build(
+            const std::string& path,
+            bool remove_duplicate_edges = false);
+
+private:
+
+    /*
+     * Private attributes
+     */
+
+    /** Prefix of the paths of the runs. */
+    std::string temporary_path_prefix_;
+
+    /** Maximum number of arcs in the buffer. */
+    EdgeId buffer_size_;
+
+    /** Maximum number of runs merged at once. */
+    EdgeId maximum_number_of_merged_runs_;
+
+    /** Weights of the vertices. */
+    std::vector<Weight> weights_;
+
+    /** Arcs which have not been written in a run yet. */
+    std::vector<std::pair<VertexId, VertexId>> buffer_;
+
+    /** Paths of the runs. */
+    std::vector<std::string> runs_paths_;
+
+    /** Number of runs created, used to name the runs. */
+    EdgeId number_of_runs_ = 0;
+
+    /** Number of edges added. */
+    EdgeId number_of_edges_ = 0;
+
+    /*
+     * Private methods
+     */
+
+    /** Get the path of a new run. */
+    std::string new_run_path();
+
+    /** Sort the buffer and write it in a new run. */
+    void write_run();
+
+};
+
+}
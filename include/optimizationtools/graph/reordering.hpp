@@ -0,0 +1,120 @@
+#pragma once
+
+#include "optimizationtools/graph/adjacency_list_graph.hpp"
+
+#include <vector>
+
+namespace optimizationtools
+{
+
+/*
+ * Vertex reorderings.
+ *
+ * Instance files often come with an arbitrary vertex numbering. Then, the
+ * algorithms which scan the neighbors of the vertices access the vertex
+ * arrays at random positions. Relabelling the vertices such that adjacent
+ * vertices get close ids improves the cache locality of these accesses.
+ *
+ * The algorithms are run on the reordered graph and their solutions are
+ * mapped back to the original vertex ids with the 'to_original_*' functions.
+ */
+
+enum class VertexOrdering
+{
+    /** Reverse Cuthill-McKee: breadth first search reducing the bandwidth. */
+    ReverseCuthillMcKee,
+
+    /** Vertices sorted by non-increasing degree. */
+    DegreeDescending,
+
+    /**
+     * Degeneracy order: vertices in the order in which they are removed when
+     * repeatedly removing a vertex of minimum degree.
+     */
+    Degeneracy,
+
+    /**
+     * Gorder-style heuristic: greedily append the vertex sharing the most
+     * edges and common neighbors with the last vertices of the order.
+     */
+    Gorder,
+};
+
+/**
+ * Structure storing a permutation of the vertices of a graph.
+ */
+struct VertexReordering
+{
+    /**
+     * For each vertex of the reordered graph, its id in the original graph.
+     */
+    std::vector<VertexId> original_vertex_ids;
+
+    /**
+     * For each vertex of the original graph, its id in the reordered graph.
+     */
+    std::vector<VertexId> new_vertex_ids;
+};
+
+/**
+ * Compute a vertex reordering of a graph.
+ *
+ * 'window_size' is only used by the 'Gorder' ordering.
+ */
+VertexReordering compute_vertex_reordering(
+        const AdjacencyListGraph& graph,
+        VertexOrdering ordering,
+        VertexPos window_size = 5);
+
+/**
+ * Build a vertex reordering from the list of the original vertex ids in
+ * their new order.
+ */
+VertexReordering vertex_reordering(
+        const std::vector<VertexId>& original_vertex_ids);
+
+/**
+ * Relabel the vertices of a graph.
+ *
+ * Vertex 'original_vertex_ids[v]' of the original graph becomes vertex 'v' of
+ * the returned graph. The weights are kept and the neighbors of each vertex
+ * are sorted by increasing id.
+ */
+AdjacencyListGraph reorder(
+        const AdjacencyListGraph& graph,
+        const VertexReordering& reordering);
+
+/**
+ * Map vertex ids of the reordered graph back to the original graph.
+ */
+std::vector<VertexId> to_original_vertex_ids(
+        const VertexReordering& reordering,
+        const std::vector<VertexId>& vertex_ids);
+
+/**
+ * Map lists of vertex ids of the reordered graph (for example, cliques) back
+ * to the original graph.
+ */
+std::vector<std::vector<VertexId>> to_original_vertex_ids(
+        const VertexReordering& reordering,
+        const std::vector<std::vector<VertexId>>& vertex_ids);
+
+/**
+ * Map values indexed by the vertices of the reordered graph (for example,
+ * colors or sides) back to the vertices of the original graph.
+ */
+template <typename T>
+std::vector<T> to_original_vertex_values(
+        const VertexReordering& reordering,
+        const std::vector<T>& values)
+{
+    std::vector<T> original_values(values.size());
+    for (VertexId vertex_id = 0;
+            vertex_id < (VertexId)values.size();
+            ++vertex_id) {
+        original_values[reordering.original_vertex_ids[vertex_id]] = values[vertex_id];
+    }
+    return original_values;
+}
+
+}
@@ -0,0 +1,199 @@
+#pragma once
+
+#include "optimizationtools/graph/adjacency_list_graph.hpp"
+
+#include "optimizationtools/containers/indexed_set.hpp"
+
+#include <vector>
+
+namespace optimizationtools
+{
+
+/**
+ * Subgraph of an AdjacencyListGraph induced by a set of active vertices.
+ *
+ * The vertices keep their ids in the original graph. The neighbors of a
+ * vertex are the active vertices among its neighbors in the original graph;
+ * they are filtered on the fly, so activating or deactivating a vertex only
+ * costs its degree, and the degrees, the number of edges and the total
+ * weight of the subgraph are updated incrementally.
+ *
+ * When the same subgraph is scanned many times, 'materialize' stores the
+ * neighbors of the active vertices in compressed sparse row form. Removing
+ * vertices keeps the materialized neighbors, which are then still filtered;
+ * adding a vertex discards them.
+ *
+ * The view keeps a reference to the original graph, which must outlive it.
+ */
+class SubgraphView
+{
+
+public:
+
+    /*
+     * Constructors and destructor
+     */
+
+    /** Create a view in which all the vertices are active. */
+    SubgraphView(const AdjacencyListGraph& graph);
+
+    /** Create a view in which the given vertices are active. */
+    SubgraphView(
+            const AdjacencyListGraph& graph,
+            const std::vector<VertexId>& vertex_ids);
+
+    /*
+     * Getters
+     */
+
+    /** Get the original graph. */
+    inline const AdjacencyListGraph& graph() const { return *graph_; }
+
+    /** Get the set of active vertices. */
+    inline const IndexedSet& vertices() const { return vertices_; }
+
+    /** Return 'true' iff a vertex is active. */
+    inline bool contains(VertexId vertex_id) const { return vertices_.contains(vertex_id); }
+
+    /** Get the number of active vertices. */
+    inline VertexPos number_of_vertices() const { return vertices_.size(); }
+
+    /** Get the number of edges between active vertices. */
+    inline EdgeId number_of_edges() const { return number_of_edges_; }
+
+    /** Get the degree of an active vertex in the subgraph. */
+    inline VertexPos degree(VertexId vertex_id) const { return degrees_[vertex_id]; }
+
+    /** Get the weight of a vertex. */
+    inline Weight weight(VertexId vertex_id) const { return graph_->weight(vertex_id); }
+
+    /** Get the total weight of the active vertices. */
+    inline Weight total_weight() const { return total_weight_; }
+
+    /** Return 'true' iff the neighbors are materialized. */
+    inline bool is_materialized() const { return !neighbors_offsets_.empty(); }
+
+    /**
+     * Call 'function(neighbor_id)' for each active neighbor of an active
+     * vertex.
+     */
+    template <typename Function>
+    inline void for_each_neighbor(
+            VertexId vertex_id,
+            Function function) const;
+
+    /**
+     * Build the subgraph as an AdjacencyListGraph.
+     *
+     * Vertex 'i' of the returned graph is vertex 'original_vertex_ids[i]' of
+     * the original graph. The active vertices are numbered by increasing id.
+     */
+    AdjacencyListGraph build_graph(
+            std::vector<VertexId>& original_vertex_ids) const;
+
+    /*
+     * Setters
+     */
+
+    /** Activate a vertex. */
+    inline void add_vertex(VertexId vertex_id);
+
+    /** Deactivate a vertex. */
+    inline void remove_vertex(VertexId vertex_id);
+
+    /**
+     * Store the neighbors of the active vertices in compressed sparse row
+     * form.
+     */
+    void materialize();
+
+private:
+
+    /*
+     * Private attributes
+     */
+
+    /** Original graph. */
+    const AdjacencyListGraph* graph_;
+
+    /** Active vertices. */
+    IndexedSet vertices_;
+
+    /** For each active vertex, its degree in the subgraph. */
+    std::vector<VertexPos> degrees_;
+
+    /** Number of edges between active vertices. */
+    EdgeId number_of_edges_ = 0;
+
+    /** Total weight of the active vertices. */
+    Weight total_weight_ = 0;
+
+    /**
+     * If the neighbors are materialized, for each vertex, the position of
+     * its first materialized neighbor in 'neighbors_', followed by the total
+     * number of materialized neighbors; empty otherwise.
+     */
+    std::vector<EdgeId> neighbors_offsets_;
+
+    /** Materialized neighbors. */
+    std::vector<VertexId> neighbors_;
+
+};
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename Function>
+inline void SubgraphView::for_each_neighbor(
+        VertexId vertex_id,
+        Function function) const
+{
+    if (is_materialized()) {
+        for (EdgeId pos = neighbors_offsets_[vertex_id];
+                pos < neighbors_offsets_[vertex_id + 1];
+                ++pos) {
+            if (vertices_.contains(neighbors_[pos]))
+                function(neighbors_[pos]);
+        }
+    } else {
+        for (VertexId neighbor_id: graph_->vertex(vertex_id).neighbors)
+            if (vertices_.contains(neighbor_id))
+                function(neighbor_id);
+    }
+}
+
+inline void SubgraphView::add_vertex(VertexId vertex_id)
+{
+    if (vertices_.contains(vertex_id))
+        return;
+    // The materialized neighbors don't contain the new vertex.
+    neighbors_offsets_.clear();
+    neighbors_.clear();
+
+    vertices_.add(vertex_id);
+    degrees_[vertex_id] = 0;
+    for (VertexId neighbor_id: graph_->vertex(vertex_id).neighbors) {
+        if (vertices_.contains(neighbor_id)) {
+            degrees_[vertex_id]++;
+            degrees_[neighbor_id]++;
+        }
+    }
+    number_of_edges_ += degrees_[vertex_id];
+    total_weight_ += graph_->weight(vertex_id);
+}
+
+inline void SubgraphView::remove_vertex(VertexId vertex_id)
+{
+    if (!vertices_.contains(vertex_id))
+        return;
+    for_each_neighbor(
+            vertex_id,
+            [this](VertexId neighbor_id) { degrees_[neighbor_id]--; });
+    vertices_.remove(vertex_id);
+    number_of_edges_ -= degrees_[vertex_id];
+    degrees_[vertex_id] = 0;
+    total_weight_ -= graph_->weight(vertex_id);
+}
+
+}
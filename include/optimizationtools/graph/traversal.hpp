@@ -0,0 +1,126 @@
+#pragma once
+
+#include "optimizationtools/graph/abstract_graph.hpp"
+
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+namespace optimizationtools
+{
+
+/*
+ * The functions of this file are templated on the graph type. The graph type
+ * must provide the methods:
+ * - 'VertexPos number_of_vertices() const'
+ * - 'void for_each_neighbor(VertexId vertex_id, Function function) const'
+ *
+ * 'AdjacencyListGraph', 'AdjacencyMatrixGraph', 'CliqueGraph' and
+ * 'ComplementGraphView' provide non-virtual versions of these methods, so
+ * that the neighbor loops are inlined. Calling them on an 'AbstractGraph'
+ * goes through the virtual methods instead.
+ */
+
+struct BreadthFirstSearchOutput
+{
+    /** Vertices in the order in which they have been visited. */
+    std::vector<VertexId> order;
+
+    /**
+     * For each vertex, its distance (number of edges) to the source, or '-1'
+     * if it is not reachable from the source.
+     */
+    std::vector<VertexPos> distances;
+
+    /**
+     * For each vertex, its parent in the breadth first search tree, or '-1'
+     * for the source and for the vertices not reachable from the source.
+     */
+    std::vector<VertexId> parents;
+};
+
+/**
+ * Run a breadth first search from a vertex.
+ */
+template <typename Graph>
+BreadthFirstSearchOutput breadth_first_search(
+        const Graph& graph,
+        VertexId source_id);
+
+/**
+ * Run a depth first search from a vertex.
+ *
+ * Return the vertices reachable from the source in preorder.
+ */
+template <typename Graph>
+std::vector<VertexId> depth_first_search(
+        const Graph& graph,
+        VertexId source_id);
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename Graph>
+BreadthFirstSearchOutput breadth_first_search(
+        const Graph& graph,
+        VertexId source_id)
+{
+    BreadthFirstSearchOutput output;
+    output.distances.resize(graph.number_of_vertices(), -1);
+    output.parents.resize(graph.number_of_vertices(), -1);
+
+    // 'output.order' is used as the queue.
+    output.order.push_back(source_id);
+    output.distances[source_id] = 0;
+    for (VertexPos queue_position = 0;
+            queue_position < (VertexPos)output.order.size();
+            ++queue_position) {
+        VertexId vertex_id = output.order[queue_position];
+        VertexPos distance = output.distances[vertex_id] + 1;
+        graph.for_each_neighbor(
+                vertex_id,
+                [&output, vertex_id, distance](VertexId neighbor_id)
+                {
+                    if (output.distances[neighbor_id] != -1)
+                        return;
+                    output.distances[neighbor_id] = distance;
+                    output.parents[neighbor_id] = vertex_id;
+                    output.order.push_back(neighbor_id);
+                });
+    }
+    return output;
+}
+
+template <typename Graph>
+std::vector<VertexId> depth_first_search(
+        const Graph& graph,
+        VertexId source_id)
+{
+    std::vector<VertexId> order;
+    std::vector<uint8_t> vertices_visited(graph.number_of_vertices(), 0);
+    std::vector<VertexId> stack = {source_id};
+    while (!stack.empty()) {
+        VertexId vertex_id = stack.back();
+        stack.pop_back();
+        if (vertices_visited[vertex_id])
+            continue;
+        vertices_visited[vertex_id] = 1;
+        order.push_back(vertex_id);
+
+        // Neighbors are pushed in reverse order so that they are visited in
+        // the order given by 'for_each_neighbor'.
+        VertexPos stack_size = stack.size();
+        graph.for_each_neighbor(
+                vertex_id,
+                [&stack, &vertices_visited](VertexId neighbor_id)
+                {
+                    if (!vertices_visited[neighbor_id])
+                        stack.push_back(neighbor_id);
+                });
+        std::reverse(stack.begin() + stack_size, stack.end());
+    }
+    return order;
+}
+
+}
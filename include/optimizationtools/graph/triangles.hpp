@@ -0,0 +1,49 @@
+#pragma once
+
+#include "optimizationtools/graph/adjacency_list_graph.hpp"
+
+#include <vector>
+
+namespace optimizationtools
+{
+
+/**
+ * Structure storing the number of triangles of a graph.
+ */
+struct TriangleCounts
+{
+    /** Number of triangles of the graph. */
+    Counter number_of_triangles = 0;
+
+    /** For each vertex, the number of triangles containing it. */
+    std::vector<Counter> vertices_number_of_triangles;
+
+    /**
+     * For each edge, the number of triangles containing it, also called its
+     * support.
+     */
+    std::vector<Counter> edges_number_of_triangles;
+};
+
+/**
+ * Count the triangles of a graph.
+ *
+ * The vertices are ranked by degree, then by id, and each edge is oriented
+ * from its end of lower rank to its end of higher rank. Each vertex then has
+ * O(sqrt(m)) out-neighbors, stored sorted by rank. For each vertex 'u', its
+ * out-neighbors are marked in an array; then, for each out-neighbor 'v' of
+ * 'u', each marked out-neighbor 'w' of 'v' gives the triangle '(u, v, w)'.
+ * Each triangle is found exactly once, in O(m sqrt(m)) time overall.
+ *
+ * The vertices 'u' are distributed dynamically to 'number_of_threads'
+ * threads, each thread having its own array of marks; the counts are then
+ * incremented atomically.
+ *
+ * Parallel edges are considered once; their triangles are counted for the
+ * one with the smallest id, the others having a count of 0.
+ */
+TriangleCounts count_triangles(
+        const AdjacencyListGraph& graph,
+        int number_of_threads = 1);
+
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+#  include <intrin.h>
+#endif
+
+namespace optimizationtools
+{
+
+/** Index of the lowest set bit of a non-zero word. */
+inline int lowest_bit(uint64_t word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(word);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+    unsigned long bit;
+    _BitScanForward64(&bit, word);
+    return bit;
+#else
+    int bit = 0;
+    while (((word >> bit) & 1) == 0)
+        bit++;
+    return bit;
+#endif
+}
+
+/** Index of the highest set bit of a non-zero word. */
+inline int highest_bit(uint64_t word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return 63 - __builtin_clzll(word);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+    unsigned long bit;
+    _BitScanReverse64(&bit, word);
+    return bit;
+#else
+    int bit = 63;
+    while (((word >> bit) & 1) == 0)
+        bit--;
+    return bit;
+#endif
+}
+
+}
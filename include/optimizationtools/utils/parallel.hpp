@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+namespace optimizationtools
+{
+
+/**
+ * Call 'function(thread_id)' for each thread id in parallel.
+ *
+ * With a single thread, the function is called in the calling thread.
+ */
+template <typename Function>
+void run_in_parallel(
+        int number_of_threads,
+        const Function& function)
+{
+    if (number_of_threads <= 1) {
+        function(0);
+        return;
+    }
+    std::vector<std::thread> threads;
+    for (int thread_id = 0; thread_id < number_of_threads; ++thread_id)
+        threads.push_back(std::thread(function, thread_id));
+    for (std::thread& thread: threads)
+        thread.join();
+}
+
+/**
+ * Barrier for a fixed number of threads, which can be reused.
+ *
+ * It lets the threads started by 'run_in_parallel' synchronize between the
+ * steps of an algorithm instead of being started again for each step. The
+ * writes made by a thread before 'wait' are visible to all the threads after
+ * it.
+ */
+class Barrier
+{
+
+public:
+
+    /** Constructor. */
+    Barrier(int number_of_threads):
+        number_of_threads_(number_of_threads) { }
+
+    /** Block until all the threads have called 'wait'. */
+    void wait()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        int64_t generation = generation_;
+        number_of_waiting_threads_++;
+        if (number_of_waiting_threads_ == number_of_threads_) {
+            number_of_waiting_threads_ = 0;
+            generation_++;
+            condition_variable_.notify_all();
+            return;
+        }
+        condition_variable_.wait(
+                lock,
+                [this, generation]() { return generation_ != generation; });
+    }
+
+private:
+
+    /** Number of threads. */
+    int number_of_threads_;
+
+    /** Number of threads waiting at the barrier. */
+    int number_of_waiting_threads_ = 0;
+
+    /** Number of times all the threads have reached the barrier. */
+    int64_t generation_ = 0;
+
+    /** Mutex. */
+    std::mutex mutex_;
+
+    /** Condition variable. */
+    std::condition_variable condition_variable_;
+
+};
+
+}
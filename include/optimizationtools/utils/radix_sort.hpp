@@ -0,0 +1,165 @@
+#pragma once
+
+#include "optimizationtools/utils/parallel.hpp"
+
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+
+namespace optimizationtools
+{
+
+/**
+ * Convert a floating point number into an unsigned integer such that the
+ * order between the integers is the same as the order between the numbers.
+ */
+inline uint64_t radix_sort_key(double value)
+{
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return (bits >> 63)?
+        ~bits:
+        bits | ((uint64_t)1 << 63);
+}
+
+/**
+ * Sort a vector of values according to a vector of keys.
+ *
+ * Least significant digit radix sort with 8-bit digits. The histograms of all
+ * the digits are computed in a single pass, and the digits which are the same
+ * for all the keys are skipped. The sort is stable.
+ *
+ * Both vectors are sorted.
+ */
+template <typename Value>
+inline void radix_sort(
+        std::vector<uint64_t>& keys,
+        std::vector<Value>& values)
+{
+    typedef int64_t Position;
+    Position number_of_elements = keys.size();
+
+    std::vector<Position> histograms(8 * 256, 0);
+    for (uint64_t key: keys)
+        for (int digit = 0; digit < 8; ++digit)
+            histograms[digit * 256 + ((key >> (8 * digit)) & 255)]++;
+
+    std::vector<uint64_t> keys_tmp(number_of_elements);
+    std::vector<Value> values_tmp(number_of_elements);
+    for (int digit = 0; digit < 8; ++digit) {
+        Position* histogram = histograms.data() + digit * 256;
+
+        // Skip the digit if it is the same for all keys.
+        bool skip = false;
+        for (int bucket = 0; bucket < 256; ++bucket) {
+            if (histogram[bucket] == number_of_elements) {
+                skip = true;
+                break;
+            }
+        }
+        if (skip)
+            continue;
+
+        // Compute the starting position of each bucket.
+        Position position = 0;
+        for (int bucket = 0; bucket < 256; ++bucket) {
+            Position count = histogram[bucket];
+            histogram[bucket] = position;
+            position += count;
+        }
+
+        // Scatter.
+        for (Position pos = 0; pos < number_of_elements; ++pos) {
+            Position& position_new = histogram[(keys[pos] >> (8 * digit)) & 255];
+            keys_tmp[position_new] = keys[pos];
+            values_tmp[position_new] = values[pos];
+            position_new++;
+        }
+        keys.swap(keys_tmp);
+        values.swap(values_tmp);
+    }
+}
+
+/**
+ * Sort a vector of keys smaller than 'key_bound'.
+ *
+ * Least significant digit radix sort with as few passes as possible, using
+ * digits of at most 16 bits.
+ *
+ * At each pass, each thread counts the digits of its range of keys; the
+ * counts give the position of the keys of each thread for each digit, so
+ * that the threads can then move their keys independently, in a stable way.
+ */
+inline void radix_sort(
+        std::vector<uint64_t>& keys,
+        uint64_t key_bound,
+        int number_of_threads = 1)
+{
+    const std::size_t number_of_elements = keys.size();
+    if (number_of_threads < 1 || number_of_elements < (1 << 16))
+        number_of_threads = 1;
+
+    // Balance the size of the digits.
+    int number_of_bits = 0;
+    while (number_of_bits < 64 && ((key_bound - 1) >> number_of_bits) != 0)
+        number_of_bits++;
+    int number_of_passes = (number_of_bits + 15) / 16;
+    if (number_of_passes == 0)
+        return;
+    const int number_of_bits_per_digit = (number_of_bits + number_of_passes - 1) / number_of_passes;
+    const std::size_t number_of_buckets = (std::size_t)1 << number_of_bits_per_digit;
+    const uint64_t digit_mask = number_of_buckets - 1;
+
+    std::vector<uint64_t> keys_tmp(number_of_elements);
+    std::vector<std::vector<std::size_t>> positions(
+            number_of_threads,
+            std::vector<std::size_t>(number_of_buckets));
+    for (int shift = 0;
+            shift < number_of_bits;
+            shift += number_of_bits_per_digit) {
+
+        // Count the digits of the keys of each thread.
+        run_in_parallel(
+                number_of_threads,
+                [&keys, &positions, number_of_elements, shift, digit_mask, number_of_threads](
+                    int thread_id)
+                {
+                    std::vector<std::size_t>& counts = positions[thread_id];
+                    std::fill(counts.begin(), counts.end(), 0);
+                    std::size_t pos_start = number_of_elements * thread_id / number_of_threads;
+                    std::size_t pos_end = number_of_elements * (thread_id + 1) / number_of_threads;
+                    for (std::size_t pos = pos_start; pos < pos_end; ++pos)
+                        counts[(keys[pos] >> shift) & digit_mask]++;
+                });
+
+        // Compute the first position of the keys of each thread for each
+        // bucket.
+        std::size_t position = 0;
+        for (std::size_t bucket = 0; bucket < number_of_buckets; ++bucket) {
+            for (int thread_id = 0; thread_id < number_of_threads; ++thread_id) {
+                std::size_t count = positions[thread_id][bucket];
+                positions[thread_id][bucket] = position;
+                position += count;
+            }
+        }
+
+        // Scatter.
+        run_in_parallel(
+                number_of_threads,
+                [&keys, &keys_tmp, &positions, number_of_elements, shift, digit_mask, number_of_threads](
+                    int thread_id)
+                {
+                    std::vector<std::size_t>& next_positions = positions[thread_id];
+                    std::size_t pos_start = number_of_elements * thread_id / number_of_threads;
+                    std::size_t pos_end = number_of_elements * (thread_id + 1) / number_of_threads;
+                    for (std::size_t pos = pos_start; pos < pos_end; ++pos) {
+                        uint64_t key = keys[pos];
+                        keys_tmp[next_positions[(key >> shift) & digit_mask]++] = key;
+                    }
+                });
+        keys.swap(keys_tmp);
+    }
+}
+
+}
@@ -1,36 +1,117 @@
 #include "optimizationtools/graph/adjacency_list_graph.hpp"
 
+#include "optimizationtools/graph/connected_components.hpp"
+#include "optimizationtools/graph/graph_reader.hpp"
+
 #include "optimizationtools/containers/indexed_set.hpp"
 #include "optimizationtools/utils/utils.hpp"
+#include "optimizationtools/utils/radix_sort.hpp"
+#include "optimizationtools/utils/parallel.hpp"
 
 #include <vector>
+#include <algorithm>
 #include <fstream>
+#include <cstring>
+#include <thread>
 
 using namespace optimizationtools;
 
+namespace
+{
+
+/**
+ * Write the decimal representation of an integer to a buffer and return a
+ * pointer past the last character written.
+ */
+inline char* write_integer(
+        char* buffer,
+        int64_t value)
+{
+    uint64_t absolute_value = value;
+    if (value < 0) {
+        *(buffer++) = '-';
+        absolute_value = -absolute_value;
+    }
+    char digits[20];
+    int number_of_digits = 0;
+    do {
+        digits[number_of_digits++] = '0' + (absolute_value % 10);
+        absolute_value /= 10;
+    } while (absolute_value != 0);
+    while (number_of_digits > 0)
+        *(buffer++) = digits[--number_of_digits];
+    return buffer;
+}
+
+/**
+ * Write the edges of a graph to a file.
+ *
+ * The edges are split into chunks. At each round, each thread formats a chunk
+ * into its own buffer with 'write_edge'. Then the buffers are written to the
+ * file in order with a single call to 'write' each.
+ *
+ * 'write_edge(buffer, edge_id)' must write the line of edge 'edge_id' to the
+ * buffer, in at most 'maximum_line_length' characters, and return a pointer
+ * past the last character written.
+ */
+template <typename WriteEdge>
+void write_edges(
+        std::ofstream& file,
+        EdgeId number_of_edges,
+        int number_of_threads,
+        const WriteEdge& write_edge)
+{
+    const EdgeId chunk_size = 1 << 18;
+    const std::size_t maximum_line_length = 64;
+    if (number_of_threads < 1)
+        number_of_threads = 1;
+
+    std::vector<std::vector<char>> buffers(
+            number_of_threads,
+            std::vector<char>((std::min)(chunk_size, number_of_edges) * maximum_line_length));
+    std::vector<std::size_t> buffers_sizes(number_of_threads, 0);
+    auto format_chunk = [&write_edge, &buffers, &buffers_sizes, number_of_edges, chunk_size](
+            int thread_id,
+            EdgeId edge_id_start)
+    {
+        char* buffer_start = buffers[thread_id].data();
+        char* buffer = buffer_start;
+        EdgeId edge_id_end = (std::min)(edge_id_start + chunk_size, number_of_edges);
+        for (EdgeId edge_id = edge_id_start; edge_id < edge_id_end; ++edge_id)
+            buffer = write_edge(buffer, edge_id);
+        buffers_sizes[thread_id] = buffer - buffer_start;
+    };
+
+    for (EdgeId edge_id_start = 0;
+            edge_id_start < number_of_edges;
+            edge_id_start += chunk_size * number_of_threads) {
+        int number_of_chunks = 0;
+        std::vector<std::thread> threads;
+        for (int thread_id = 0; thread_id < number_of_threads; ++thread_id) {
+            EdgeId chunk_start = edge_id_start + thread_id * chunk_size;
+            if (chunk_start >= number_of_edges)
+                break;
+            number_of_chunks++;
+            if (number_of_threads == 1) {
+                format_chunk(thread_id, chunk_start);
+            } else {
+                threads.push_back(std::thread(format_chunk, thread_id, chunk_start));
+            }
+        }
+        for (std::thread& thread: threads)
+            thread.join();
+        for (int thread_id = 0; thread_id < number_of_chunks; ++thread_id)
+            file.write(buffers[thread_id].data(), buffers_sizes[thread_id]);
+    }
+}
+
+}
+
 void AdjacencyListGraphBuilder::read(
         const std::string& instance_path,
         const std::string& format)
 {
-    std::ifstream file(instance_path);
-    if (!file.good())
-        throw std::runtime_error(
-                "Unable to open file \"" + instance_path + "\".");
-
-    if (format == "dimacs" || format == "dimacs1992") {
-        read_dimacs1992(file);
-    } else if (format == "dimacs2010") {
-        read_dimacs2010(file);
-    } else if (format == "matrixmarket") {
-        read_matrixmarket(file);
-    } else if (format == "snap") {
-        read_snap(file);
-    } else if (format == "chaco") {
-        read_chaco(file);
-    } else {
-        throw std::invalid_argument(
-                "Unknown instance format \"" + format + "\".");
-    }
+    read_graph(instance_path, format, *this);
 }
 
 VertexId AdjacencyListGraphBuilder::add_vertex(Weight weight)
@@ -111,29 +192,209 @@ void AdjacencyListGraphBuilder::clear_edges()
     }
 }
 
-void AdjacencyListGraphBuilder::remove_duplicate_edges()
+void AdjacencyListGraphBuilder::set_edges(
+        std::vector<AdjacencyListGraph::Edge>&& edges,
+        int number_of_threads)
 {
-    std::vector<std::vector<VertexId>> neighbors(graph_.number_of_vertices());
-    for (VertexId vertex_id = 0;
-            vertex_id < graph_.number_of_vertices();
-            ++vertex_id) {
-        for (VertexId vertex_id_neighbor: graph_.vertices_[vertex_id].neighbors)
-            if (vertex_id_neighbor > vertex_id)
-                neighbors[vertex_id].push_back(vertex_id_neighbor);
-        sort(neighbors[vertex_id].begin(), neighbors[vertex_id].end());
-        neighbors[vertex_id].erase(
-                std::unique(
-                    neighbors[vertex_id].begin(),
-                    neighbors[vertex_id].end()),
-                neighbors[vertex_id].end());
-    }
     clear_edges();
-    for (VertexId vertex_1_id = 0;
-            vertex_1_id < graph_.number_of_vertices();
-            ++vertex_1_id) {
-        for (VertexId vertex_2_id: neighbors[vertex_1_id])
-            add_edge(vertex_1_id, vertex_2_id);
+    graph_.edges_ = std::move(edges);
+    graph_.number_of_edges_ = graph_.edges_.size();
+
+    VertexId number_of_vertices = graph_.number_of_vertices();
+    if (number_of_threads < 1)
+        number_of_threads = 1;
+    if (number_of_threads > number_of_vertices)
+        number_of_threads = (std::max)((VertexId)1, number_of_vertices);
+
+    // The edges are split into one chunk per thread. For each thread and
+    // each vertex, 'positions[thread_id * number_of_vertices + vertex_id]'
+    // first counts the ends of the chunk of the thread at the vertex, then
+    // becomes the position in the adjacency list of the vertex at which the
+    // thread writes the next of them. The chunks being in the order of the
+    // edge ids, the adjacency lists are filled in the order of the edge ids
+    // without synchronization.
+    EdgeId number_of_edges = graph_.edges_.size();
+    std::vector<VertexPos> positions(number_of_threads * number_of_vertices, 0);
+
+    // Count the ends of each chunk.
+    run_in_parallel(
+            number_of_threads,
+            [this, &positions, number_of_vertices, number_of_edges, number_of_threads](
+                int thread_id)
+            {
+                EdgeId edge_id_start = number_of_edges * thread_id / number_of_threads;
+                EdgeId edge_id_end = number_of_edges * (thread_id + 1) / number_of_threads;
+                VertexPos* thread_positions = positions.data() + thread_id * number_of_vertices;
+                for (EdgeId edge_id = edge_id_start; edge_id < edge_id_end; ++edge_id) {
+                    const AdjacencyListGraph::Edge& edge = graph_.edges_[edge_id];
+                    thread_positions[edge.vertex_1_id]++;
+                    thread_positions[edge.vertex_2_id]++;
+                }
+            });
+
+    // Compute the degrees and the positions of each chunk in each adjacency
+    // list.
+    run_in_parallel(
+            number_of_threads,
+            [this, &positions, number_of_vertices, number_of_threads](int thread_id)
+            {
+                VertexId vertex_id_start = number_of_vertices * thread_id / number_of_threads;
+                VertexId vertex_id_end = number_of_vertices * (thread_id + 1) / number_of_threads;
+                for (VertexId vertex_id = vertex_id_start;
+                        vertex_id < vertex_id_end;
+                        ++vertex_id) {
+                    VertexPos degree = 0;
+                    for (int chunk_id = 0; chunk_id < number_of_threads; ++chunk_id) {
+                        VertexPos& position = positions[chunk_id * number_of_vertices + vertex_id];
+                        VertexPos number_of_ends = position;
+                        position = degree;
+                        degree += number_of_ends;
+                    }
+                    graph_.vertices_[vertex_id].edges.resize(degree);
+                    graph_.vertices_[vertex_id].neighbors.resize(degree);
+                }
+            });
+
+    // Fill the adjacency lists.
+    run_in_parallel(
+            number_of_threads,
+            [this, &positions, number_of_vertices, number_of_edges, number_of_threads](
+                int thread_id)
+            {
+                EdgeId edge_id_start = number_of_edges * thread_id / number_of_threads;
+                EdgeId edge_id_end = number_of_edges * (thread_id + 1) / number_of_threads;
+                VertexPos* thread_positions = positions.data() + thread_id * number_of_vertices;
+                for (EdgeId edge_id = edge_id_start; edge_id < edge_id_end; ++edge_id) {
+                    const AdjacencyListGraph::Edge& edge = graph_.edges_[edge_id];
+
+                    AdjacencyListGraph::Vertex& vertex_1 = graph_.vertices_[edge.vertex_1_id];
+                    VertexPos pos_1 = thread_positions[edge.vertex_1_id]++;
+                    vertex_1.edges[pos_1].edge_id = edge_id;
+                    vertex_1.edges[pos_1].vertex_id = edge.vertex_2_id;
+                    vertex_1.neighbors[pos_1] = edge.vertex_2_id;
+
+                    AdjacencyListGraph::Vertex& vertex_2 = graph_.vertices_[edge.vertex_2_id];
+                    VertexPos pos_2 = thread_positions[edge.vertex_2_id]++;
+                    vertex_2.edges[pos_2].edge_id = edge_id;
+                    vertex_2.edges[pos_2].vertex_id = edge.vertex_1_id;
+                    vertex_2.neighbors[pos_2] = edge.vertex_1_id;
+                }
+            });
+}
+
+void AdjacencyListGraphBuilder::reserve(
+        VertexId number_of_vertices,
+        EdgeId number_of_edges)
+{
+    graph_.vertices_.reserve(number_of_vertices);
+    graph_.edges_.reserve(number_of_edges);
+}
+
+AdjacencyListGraph AdjacencyListGraphBuilder::build_from_edge_list(
+        VertexId number_of_vertices,
+        const std::vector<std::pair<VertexId, VertexId>>& edges,
+        const std::vector<Weight>& weights,
+        int number_of_threads)
+{
+    if (!weights.empty() && (VertexId)weights.size() != number_of_vertices) {
+        throw std::invalid_argument(
+                "The number of weights must be equal to the number of vertices.");
+    }
+
+    AdjacencyListGraphBuilder graph_builder;
+    graph_builder.graph_.vertices_.resize(number_of_vertices);
+    if (!weights.empty()) {
+        for (VertexId vertex_id = 0;
+                vertex_id < number_of_vertices;
+                ++vertex_id) {
+            graph_builder.graph_.vertices_[vertex_id].weight = weights[vertex_id];
+        }
+    }
+
+    std::vector<AdjacencyListGraph::Edge> graph_edges;
+    graph_edges.reserve(edges.size());
+    for (const std::pair<VertexId, VertexId>& edge: edges) {
+        if (edge.first < 0 || edge.first >= number_of_vertices
+                || edge.second < 0 || edge.second >= number_of_vertices) {
+            throw std::invalid_argument(
+                    "Invalid edge (" + std::to_string(edge.first)
+                    + ", " + std::to_string(edge.second) + ").");
+        }
+        if (edge.first == edge.second)
+            continue;
+        AdjacencyListGraph::Edge graph_edge;
+        graph_edge.vertex_1_id = edge.first;
+        graph_edge.vertex_2_id = edge.second;
+        graph_edges.push_back(graph_edge);
     }
+    graph_builder.set_edges(std::move(graph_edges), number_of_threads);
+    return graph_builder.build();
+}
+
+void AdjacencyListGraphBuilder::remove_duplicate_edges(int number_of_threads)
+{
+    number_of_threads = (std::max)(number_of_threads, 1);
+    VertexId number_of_vertices = graph_.number_of_vertices();
+    EdgeId number_of_edges = graph_.edges_.size();
+    std::vector<AdjacencyListGraph::Edge> edges;
+
+    if (number_of_vertices <= ((VertexId)1 << 32)) {
+        // Encode each edge as 'smallest_end * number_of_vertices + largest_end'
+        // so that sorting the keys sorts the edges.
+        std::vector<uint64_t> keys(number_of_edges);
+        run_in_parallel(
+                number_of_threads,
+                [this, &keys, number_of_edges, number_of_vertices, number_of_threads](
+                    int thread_id)
+                {
+                    EdgeId edge_id_start = number_of_edges * thread_id / number_of_threads;
+                    EdgeId edge_id_end = number_of_edges * (thread_id + 1) / number_of_threads;
+                    for (EdgeId edge_id = edge_id_start; edge_id < edge_id_end; ++edge_id) {
+                        const AdjacencyListGraph::Edge& edge = graph_.edges_[edge_id];
+                        uint64_t vertex_1_id = (std::min)(edge.vertex_1_id, edge.vertex_2_id);
+                        uint64_t vertex_2_id = (std::max)(edge.vertex_1_id, edge.vertex_2_id);
+                        keys[edge_id] = vertex_1_id * number_of_vertices + vertex_2_id;
+                    }
+                });
+        radix_sort(
+                keys,
+                (uint64_t)number_of_vertices * number_of_vertices,
+                number_of_threads);
+        keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+        edges.resize(keys.size());
+        for (EdgeId edge_id = 0; edge_id < (EdgeId)keys.size(); ++edge_id) {
+            edges[edge_id].vertex_1_id = keys[edge_id] / number_of_vertices;
+            edges[edge_id].vertex_2_id = keys[edge_id] % number_of_vertices;
+        }
+    } else {
+        // The keys would overflow.
+        edges.resize(number_of_edges);
+        for (EdgeId edge_id = 0; edge_id < number_of_edges; ++edge_id) {
+            const AdjacencyListGraph::Edge& edge = graph_.edges_[edge_id];
+            edges[edge_id].vertex_1_id = (std::min)(edge.vertex_1_id, edge.vertex_2_id);
+            edges[edge_id].vertex_2_id = (std::max)(edge.vertex_1_id, edge.vertex_2_id);
+        }
+        auto compare = [](
+                const AdjacencyListGraph::Edge& edge_1,
+                const AdjacencyListGraph::Edge& edge_2) -> bool
+        {
+            return (edge_1.vertex_1_id != edge_2.vertex_1_id)?
+                edge_1.vertex_1_id < edge_2.vertex_1_id:
+                edge_1.vertex_2_id < edge_2.vertex_2_id;
+        };
+        auto equal = [](
+                const AdjacencyListGraph::Edge& edge_1,
+                const AdjacencyListGraph::Edge& edge_2) -> bool
+        {
+            return edge_1.vertex_1_id == edge_2.vertex_1_id
+                && edge_1.vertex_2_id == edge_2.vertex_2_id;
+        };
+        std::sort(edges.begin(), edges.end(), compare);
+        edges.erase(std::unique(edges.begin(), edges.end(), equal), edges.end());
+    }
+
+    set_edges(std::move(edges), number_of_threads);
 }
 
 AdjacencyListGraph AdjacencyListGraph::complementary() const
@@ -170,204 +431,171 @@ AdjacencyListGraph::AdjacencyListGraph(
             ++vertex_id) {
         graph_builder.add_vertex();
     }
+    std::vector<VertexId> neighbors;
     for (VertexId vertex_id = 0;
             vertex_id < abstract_graph.number_of_vertices();
             ++vertex_id) {
-        for (auto it = abstract_graph.neighbors_begin(vertex_id);
-                it != abstract_graph.neighbors_end(vertex_id);
-                ++it) {
-            if (vertex_id > *it)
-                graph_builder.add_edge(vertex_id, *it);
-        }
+        for (VertexId neighbor_id: abstract_graph.neighbors(vertex_id, neighbors))
+            if (vertex_id > neighbor_id)
+                graph_builder.add_edge(vertex_id, neighbor_id);
     }
     *this = graph_builder.build();
 }
 
-void AdjacencyListGraphBuilder::read_dimacs1992(std::ifstream& file)
-{
-    std::string tmp;
-    std::vector<std::string> line;
-
-    while (getline(file, tmp)) {
-        line = optimizationtools::split(tmp, ' ');
-        if (line.size() == 0) {
-        } else if (line[0] == "c") {
-        } else if (line[0] == "p") {
-            VertexId number_of_vertices = stol(line[2]);
-            for (VertexId vertex_id = 0;
-                    vertex_id < number_of_vertices;
-                    ++vertex_id) {
-                add_vertex();
-            }
-        } else if (line[0] == "n") {
-            VertexId vertex_id = stol(line[1]) - 1;
-            Weight weight = stol(line[2]);
-            set_weight(vertex_id, weight);
-        } else if (line[0] == "e") {
-            VertexId vertex_1_id = stol(line[1]) - 1;
-            VertexId vertex_2_id = stol(line[2]) - 1;
-            add_edge(vertex_1_id, vertex_2_id);
-        }
-    }
-}
-
-void AdjacencyListGraphBuilder::read_dimacs2010(std::ifstream& file)
-{
-    std::string tmp;
-    std::vector<std::string> line;
-    bool first = true;
-    VertexId vertex_id = -1;
-    while (vertex_id != graph_.number_of_vertices()) {
-        getline(file, tmp);
-        //std::cout << tmp << std::endl;
-        line = optimizationtools::split(tmp, ' ');
-        if (tmp[0] == '%')
-            continue;
-        if (first) {
-            VertexId number_of_vertices = stol(line[0]);
-            for (VertexId vertex_id = 0;
-                    vertex_id < number_of_vertices;
-                    ++vertex_id) {
-                add_vertex();
-            }
-            first = false;
-            vertex_id = 0;
-        } else {
-            for (const std::string& str: line) {
-                VertexId vertex_2_id = stol(str) - 1;
-                if (vertex_2_id > vertex_id)
-                    add_edge(vertex_id, vertex_2_id);
-            }
-            vertex_id++;
-        }
-    }
-}
-
-void AdjacencyListGraphBuilder::read_matrixmarket(std::ifstream& file)
-{
-    std::string tmp;
-    std::vector<std::string> line;
-    do {
-        getline(file, tmp);
-    } while (tmp[0] == '%');
-    std::stringstream ss(tmp);
-    VertexId number_of_vertices = -1;
-    ss >> number_of_vertices;
-    for (VertexId vertex_id = 0;
-            vertex_id < number_of_vertices;
-            ++vertex_id) {
-        add_vertex();
-    }
-
-    VertexId vertex_1_id = -1;
-    VertexId vertex_2_id = -1;
-    while (getline(file, tmp)) {
-        std::stringstream ss(tmp);
-        ss >> vertex_1_id >> vertex_2_id;
-        add_edge(vertex_1_id - 1, vertex_2_id - 1);
-    }
-}
-
-void AdjacencyListGraphBuilder::read_chaco(std::ifstream& file)
-{
-    std::string tmp;
-    std::vector<std::string> line;
-
-    getline(file, tmp);
-    line = optimizationtools::split(tmp, ' ');
-    VertexId number_of_vertices = stol(line[0]);
-    for (VertexId vertex_id = 0;
-            vertex_id < number_of_vertices;
-            ++vertex_id) {
-        add_vertex();
-    }
-
-    for (VertexId vertex_id = 0;
-            vertex_id < number_of_vertices;
-            ++vertex_id) {
-        getline(file, tmp);
-        line = optimizationtools::split(tmp, ' ');
-        for (std::string str: line) {
-            VertexId vertex_2_id = stol(str) - 1;
-            if (vertex_2_id > vertex_id)
-                add_edge(vertex_id, vertex_2_id);
-        }
-    }
-}
-
-void AdjacencyListGraphBuilder::read_snap(std::ifstream& file)
-{
-    std::string tmp;
-    std::vector<std::string> line;
-    do {
-        getline(file, tmp);
-    } while (tmp[0] == '#');
-
-    VertexId vertex_1_id = -1;
-    VertexId vertex_2_id = -1;
-    for (;;) {
-        file >> vertex_1_id >> vertex_2_id;
-        if (file.eof())
-            break;
-        while ((std::max)(vertex_1_id, vertex_2_id) >= graph_.number_of_vertices())
-            add_vertex();
-        add_edge(vertex_1_id, vertex_2_id);
-    }
-}
-
 void AdjacencyListGraph::write(
         const std::string& instance_path,
-        const std::string& format) const
+        const std::string& format,
+        int number_of_threads) const
 {
-    std::ofstream file(instance_path);
+    std::ofstream file(
+            instance_path,
+            (format == "binary")? std::ios::out | std::ios::binary: std::ios::out);
     if (!file.good())
         throw std::runtime_error(
                 "Unable to open file \"" + instance_path + "\".");
 
     if (format == "dimacs") {
-        write_dimacs(file);
+        write_dimacs(file, number_of_threads);
     } else if (format == "matrixmarket") {
-        write_matrixmarket(file);
+        write_matrixmarket(file, number_of_threads);
     } else if (format == "snap") {
-        write_snap(file);
+        write_snap(file, number_of_threads);
+    } else if (format == "binary") {
+        write_binary(file);
     } else {
         throw std::invalid_argument(
                 "Unknown instance format \"" + format + "\".");
     }
 }
 
-void AdjacencyListGraph::write_snap(std::ofstream& file) const
+void AdjacencyListGraph::write_snap(
+        std::ofstream& file,
+        int number_of_threads) const
 {
-    for (EdgeId edge_id = 0; edge_id < number_of_edges(); ++edge_id)
-        file << first_end(edge_id) << " " << second_end(edge_id) << std::endl;
+    write_edges(
+            file,
+            number_of_edges(),
+            number_of_threads,
+            [this](char* buffer, EdgeId edge_id) -> char*
+            {
+                buffer = write_integer(buffer, first_end(edge_id));
+                *(buffer++) = ' ';
+                buffer = write_integer(buffer, second_end(edge_id));
+                *(buffer++) = '\n';
+                return buffer;
+            });
 }
 
-void AdjacencyListGraph::write_matrixmarket(std::ofstream& file) const
+void AdjacencyListGraph::write_matrixmarket(
+        std::ofstream& file,
+        int number_of_threads) const
 {
     file << number_of_vertices()
         << " " << number_of_vertices()
         << " " << number_of_edges()
-        << std::endl;
-    for (EdgeId edge_id = 0; edge_id < number_of_edges(); ++edge_id) {
-        file << first_end(edge_id) + 1
-            << " " << second_end(edge_id) + 1
-            << std::endl;
-    }
+        << "\n";
+    write_edges(
+            file,
+            number_of_edges(),
+            number_of_threads,
+            [this](char* buffer, EdgeId edge_id) -> char*
+            {
+                buffer = write_integer(buffer, first_end(edge_id) + 1);
+                *(buffer++) = ' ';
+                buffer = write_integer(buffer, second_end(edge_id) + 1);
+                *(buffer++) = '\n';
+                return buffer;
+            });
 }
 
-void AdjacencyListGraph::write_dimacs(std::ofstream& file) const
+void AdjacencyListGraph::write_dimacs(
+        std::ofstream& file,
+        int number_of_threads) const
 {
-    file << "p edge " << number_of_vertices() << " " << number_of_edges() << std::endl;
-    for (EdgeId edge_id = 0; edge_id < number_of_edges(); ++edge_id) {
-        file << "e " << first_end(edge_id) + 1
-            << " " << second_end(edge_id) + 1
-            << std::endl;
+    file << "p edge " << number_of_vertices() << " " << number_of_edges() << "\n";
+    write_edges(
+            file,
+            number_of_edges(),
+            number_of_threads,
+            [this](char* buffer, EdgeId edge_id) -> char*
+            {
+                *(buffer++) = 'e';
+                *(buffer++) = ' ';
+                buffer = write_integer(buffer, first_end(edge_id) + 1);
+                *(buffer++) = ' ';
+                buffer = write_integer(buffer, second_end(edge_id) + 1);
+                *(buffer++) = '\n';
+                return buffer;
+            });
+}
+
+void AdjacencyListGraph::write_binary(std::ofstream& file) const
+{
+    file.write(graph_binary_format_header, sizeof(graph_binary_format_header));
+    int64_t number_of_vertices = this->number_of_vertices();
+    int64_t number_of_edges = this->number_of_edges();
+    file.write(reinterpret_cast<const char*>(&number_of_vertices), sizeof(number_of_vertices));
+    file.write(reinterpret_cast<const char*>(&number_of_edges), sizeof(number_of_edges));
+
+    std::vector<Weight> weights(number_of_vertices);
+    for (VertexId vertex_id = 0;
+            vertex_id < number_of_vertices;
+            ++vertex_id) {
+        weights[vertex_id] = weight(vertex_id);
     }
+    file.write(reinterpret_cast<const char*>(weights.data()), number_of_vertices * sizeof(Weight));
+
+    // An edge is stored as its two ends.
+    static_assert(
+            sizeof(Edge) == 2 * sizeof(VertexId),
+            "Edge must only contain its two ends.");
+    file.write(reinterpret_cast<const char*>(edges_.data()), number_of_edges * sizeof(Edge));
 }
 
-AdjacencyListGraph AdjacencyListGraphBuilder::build()
+AdjacencyListGraph AdjacencyListGraphBuilder::build(
+        bool compute_components,
+        int number_of_threads)
 {
     graph_.total_weight_ = graph_.compute_total_weight();
     graph_.highest_degree_ = graph_.compute_highest_degree();
+    if (compute_components) {
+        std::vector<ComponentId> components = connected_components(
+                graph_,
+                number_of_threads);
+        graph_.number_of_components_ = 0;
+        for (VertexId vertex_id = 0;
+                vertex_id < graph_.number_of_vertices();
+                ++vertex_id) {
+            graph_.vertices_[vertex_id].component = components[vertex_id];
+            graph_.number_of_components_ = (std::max)(
+                    graph_.number_of_components_,
+                    components[vertex_id] + 1);
+        }
+    }
     return std::move(graph_);
 }
+
+AdjacencyListGraph optimizationtools::induced_subgraph(
+        const AdjacencyListGraph& graph,
+        const std::vector<VertexId>& vertex_ids)
+{
+    AdjacencyListGraphBuilder graph_builder;
+    for (VertexId vertex_id: vertex_ids)
+        graph_builder.add_vertex(graph.weight(vertex_id));
+    for (VertexId vertex_id = 0;
+            vertex_id < (VertexId)vertex_ids.size();
+            ++vertex_id) {
+        for (VertexId neighbor_id: graph.vertex(vertex_ids[vertex_id]).neighbors) {
+            auto it = std::lower_bound(
+                    vertex_ids.begin(),
+                    vertex_ids.end(),
+                    neighbor_id);
+            if (it == vertex_ids.end() || *it != neighbor_id)
+                continue;
+            VertexId subgraph_neighbor_id = it - vertex_ids.begin();
+            if (subgraph_neighbor_id > vertex_id)
+                graph_builder.add_edge(vertex_id, subgraph_neighbor_id);
+        }
+    }
+    return graph_builder.build();
+}
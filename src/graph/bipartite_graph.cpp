@@ -6,51 +6,66 @@
 
 using namespace optimizationtools;
 
-std::vector<uint8_t> optimizationtools::bipartite_graph_identify(
-        const AdjacencyListGraph& graph)
+BipartiteGraph::BipartiteGraph(const AdjacencyListGraph& graph):
+    graph_(&graph),
+    vertices_sides_(bipartite_graph_identify(graph))
 {
-    if (graph.number_of_vertices() == 0)
-        return {};
-    std::vector<uint8_t> vertices_sides(graph.number_of_vertices(), 2);
-    VertexId vertex_0_id = 0;
-    for (;;) {
-        while (vertex_0_id < graph.number_of_vertices()
-                && vertices_sides[vertex_0_id] != 2) {
-            vertex_0_id++;
-        }
-        if (vertex_0_id == graph.number_of_vertices())
-            break;
+    if (vertices_sides_.size() != (std::size_t)graph.number_of_vertices()) {
+        throw std::invalid_argument(
+                FUNC_SIGNATURE + ": "
+                "the graph is not bipartite.");
+    }
+    build_edges();
+}
 
-        std::vector<VertexId> queue = {vertex_0_id};
-        vertices_sides[vertex_0_id] = 0;
-        while (!queue.empty()) {
-            VertexId vertex_id = queue.back();
-            const AdjacencyListGraph::Vertex vertex = graph.vertex(vertex_id);
-            queue.pop_back();
-            for (const AdjacencyListGraph::VertexEdge& edge: vertex.edges) {
-                if (vertices_sides[edge.vertex_id] == vertices_sides[vertex_id])
-                    return {};
-                if (vertices_sides[edge.vertex_id] != 2)
-                    continue;
-                vertices_sides[edge.vertex_id] = 1 - vertices_sides[vertex_id];
-                queue.push_back(edge.vertex_id);
-            }
-        }
+BipartiteGraph::BipartiteGraph(
+        const AdjacencyListGraph& graph,
+        const std::vector<uint8_t>& vertices_sides):
+    graph_(&graph),
+    vertices_sides_(vertices_sides)
+{
+    if (vertices_sides_.size() != (std::size_t)graph.number_of_vertices()) {
+        throw std::invalid_argument(
+                FUNC_SIGNATURE + ": "
+                "wrong number of sides; "
+                "vertices_sides.size(): " + std::to_string(vertices_sides.size()) + "; "
+                "graph.number_of_vertices(): " + std::to_string(graph.number_of_vertices()) + ".");
     }
-    return vertices_sides;
+    build_edges();
 }
 
-std::vector<uint8_t> optimizationtools::bipartite_graph_maximum_matching(
-        const AdjacencyListGraph& graph)
+void BipartiteGraph::build_edges()
 {
-    //std::cout << "bipartite_graph_maximum_matching " << graph.number_of_vertices() << " " << graph.number_of_edges() << std::endl;
+    const AdjacencyListGraph& graph = *graph_;
+    edges_offsets_.resize(graph.number_of_vertices() + 1, 0);
+    for (VertexId vertex_id = 0;
+            vertex_id < graph.number_of_vertices();
+            ++vertex_id) {
+        vertices_[vertices_sides_[vertex_id]].push_back(vertex_id);
+        edges_offsets_[vertex_id + 1] = edges_offsets_[vertex_id];
+        if (vertices_sides_[vertex_id] == 0)
+            edges_offsets_[vertex_id + 1] += graph.degree(vertex_id);
+    }
+    edges_.reserve(edges_offsets_.back());
+    for (VertexId vertex_id: vertices_[0]) {
+        const AdjacencyListGraph::Vertex& vertex = graph.vertex(vertex_id);
+        edges_.insert(edges_.end(), vertex.edges.begin(), vertex.edges.end());
+    }
+}
 
-    std::vector<uint8_t> vertices_sides = bipartite_graph_identify(graph);
+const std::vector<uint8_t>& BipartiteGraph::maximum_matching()
+{
+    if (matching_is_computed_)
+        return edges_matched_;
+    const AdjacencyListGraph& graph = *graph_;
 
     // Find an initial maximal matching.
-    std::vector<VertexId> vertices_matched_edge(graph.number_of_vertices(), -1);
-    std::vector<uint8_t> edges_matched(graph.number_of_edges(), 0);
-    EdgeId matching_size = 0;
+    std::vector<EdgeId>& vertices_matched_edge = vertices_matched_edge_;
+    std::vector<uint8_t>& edges_matched = edges_matched_;
+    EdgeId& matching_size = matching_size_;
+    matching_size = 0;
+    vertices_matched_edge.assign(graph.number_of_vertices(), -1);
+    edges_matched.assign(graph.number_of_edges(), 0);
     for (EdgeId edge_id = 0; edge_id < graph.number_of_edges(); ++edge_id) {
         const AdjacencyListGraph::Edge& edge = graph.edge(edge_id);
         if (vertices_matched_edge[edge.vertex_1_id] != -1)
@@ -66,8 +81,10 @@ std::vector<uint8_t> optimizationtools::bipartite_graph_maximum_matching(
     if (matching_size > graph.number_of_edges()) {
         throw std::logic_error(FUNC_SIGNATURE);
     }
-    if (matching_size == graph.number_of_vertices() / 2)
+    if (matching_size == graph.number_of_vertices() / 2) {
+        matching_is_computed_ = true;
         return edges_matched;
+    }
 
     std::vector<VertexId> bfs_queue(graph.number_of_vertices(), -1);
     std::vector<VertexId> dist(graph.number_of_vertices(), graph.number_of_vertices() + 1);
@@ -82,11 +99,7 @@ std::vector<uint8_t> optimizationtools::bipartite_graph_maximum_matching(
         std::fill(dist.begin(), dist.end(), graph.number_of_vertices() + 1);
         unmatched_leaves.clear();
         VertexId queue_push_pos = 0;
-        for (VertexId vertex_id = 0;
-                vertex_id < graph.number_of_vertices();
-                ++vertex_id) {
-            if (vertices_sides[vertex_id] == 1)
-                continue;
+        for (VertexId vertex_id: vertices_[0]) {
             if (vertices_matched_edge[vertex_id] == -1) {
                 dist[vertex_id] = 0;
                 bfs_queue[queue_push_pos] = vertex_id;
@@ -97,23 +110,31 @@ std::vector<uint8_t> optimizationtools::bipartite_graph_maximum_matching(
                 queue_pop_pos < queue_push_pos;
                 ++queue_pop_pos) {
             VertexId vertex_id = bfs_queue[queue_pop_pos];
-            const AdjacencyListGraph::Vertex& vertex = graph.vertex(vertex_id);
             bool has_child = false;
-            for (const AdjacencyListGraph::VertexEdge& edge: vertex.edges) {
-                if (dist[vertex_id] % 2 == 0) {
-                    if (edges_matched[edge.edge_id] == 1)
-                        continue;
-                } else {
-                    if (edges_matched[edge.edge_id] == 0)
-                        continue;
-                }
+            auto visit = [&dist, &pred, &bfs_queue, &queue_push_pos, &has_child, vertex_id](
+                    const AdjacencyListGraph::VertexEdge& edge)
+            {
                 if (dist[edge.vertex_id] <= dist[vertex_id] + 1)
-                    continue;
+                    return;
                 dist[edge.vertex_id] = dist[vertex_id] + 1;
                 pred[edge.vertex_id] = edge.edge_id;
                 bfs_queue[queue_push_pos] = edge.vertex_id;
                 queue_push_pos++;
                 has_child = true;
+            };
+            if (dist[vertex_id] % 2 == 0) {
+                // Vertex of side 0: follow the unmatched edges.
+                for_each_edge(
+                        vertex_id,
+                        [&edges_matched, &visit](const AdjacencyListGraph::VertexEdge& edge)
+                        {
+                            if (edges_matched[edge.edge_id] == 0)
+                                visit(edge);
+                        });
+            } else if (vertices_matched_edge[vertex_id] != -1) {
+                // Vertex of side 1: follow the matched edge.
+                EdgeId edge_id = vertices_matched_edge[vertex_id];
+                visit({edge_id, graph.other_end(edge_id, vertex_id)});
             }
             if (vertices_matched_edge[vertex_id] == -1
                     && dist[vertex_id] > 0
@@ -191,32 +212,33 @@ std::vector<uint8_t> optimizationtools::bipartite_graph_maximum_matching(
         }
     }
 
+    matching_is_computed_ = true;
     return edges_matched;
 }
 
-std::vector<uint8_t> optimizationtools::bipartite_graph_minimum_cover(
-        const AdjacencyListGraph& graph)
+const std::vector<uint8_t>& BipartiteGraph::minimum_cover()
 {
-    std::vector<uint8_t> maximum_matching = bipartite_graph_maximum_matching(graph);
-    std::vector<uint8_t> vertices_sides = bipartite_graph_identify(graph);
+    if (cover_is_computed_)
+        return cover_;
+    const AdjacencyListGraph& graph = *graph_;
+    const std::vector<uint8_t>& maximum_matching = this->maximum_matching();
+    const std::vector<uint8_t>& vertices_sides = vertices_sides_;
 
-    // Build mate array: for each vertex, store its matched mate_id or -1
+    // Mate of each vertex, '-1' if it is not matched.
     std::vector<VertexId> mate(graph.number_of_vertices(), -1);
-    for (EdgeId edge_id = 0; edge_id < graph.number_of_edges(); ++edge_id) {
-        if (maximum_matching[edge_id] == 1) {
-            const AdjacencyListGraph::Edge& edge = graph.edge(edge_id);
-            mate[edge.vertex_1_id] = edge.vertex_2_id;
-            mate[edge.vertex_2_id] = edge.vertex_1_id;
-        }
+    for (VertexId vertex_id = 0;
+            vertex_id < graph.number_of_vertices();
+            ++vertex_id) {
+        EdgeId edge_id = vertices_matched_edge_[vertex_id];
+        if (edge_id != -1 && maximum_matching[edge_id] == 1)
+            mate[vertex_id] = graph.other_end(edge_id, vertex_id);
     }
 
     // BFS from unmatched left vertices
     std::vector<uint8_t> visited(graph.number_of_vertices(), 0);
     std::vector<VertexId> queue;
-    for (VertexId vertex_id = 0;
-            vertex_id < graph.number_of_vertices();
-            ++vertex_id) {
-        if (vertices_sides[vertex_id] == 0 && mate[vertex_id] == -1) {
+    for (VertexId vertex_id: vertices_[0]) {
+        if (mate[vertex_id] == -1) {
             visited[vertex_id] = 1;
             queue.push_back(vertex_id);
         }
@@ -227,15 +249,17 @@ std::vector<uint8_t> optimizationtools::bipartite_graph_minimum_cover(
         VertexId mate_id = mate[vertex_id];
         if (vertices_sides[vertex_id] == 0) {
             // vertex in L: traverse only non-matching edges to R
-            const AdjacencyListGraph::Vertex& vertex = graph.vertex(vertex_id);
-            for (const AdjacencyListGraph::VertexEdge& edge: vertex.edges) {
-                if (mate_id == edge.vertex_id)
-                    continue;
-                if (visited[edge.vertex_id])
-                    continue;
-                visited[edge.vertex_id] = 1;
-                queue.push_back(edge.vertex_id);
-            }
+            for_each_edge(
+                    vertex_id,
+                    [&visited, &queue, mate_id](const AdjacencyListGraph::VertexEdge& edge)
+                    {
+                        if (mate_id == edge.vertex_id)
+                            return;
+                        if (visited[edge.vertex_id])
+                            return;
+                        visited[edge.vertex_id] = 1;
+                        queue.push_back(edge.vertex_id);
+                    });
         } else {
             // vertex in R: traverse only the matching edge back to L
             if (mate_id != -1 && !visited[mate_id]) {
@@ -246,7 +270,8 @@ std::vector<uint8_t> optimizationtools::bipartite_graph_minimum_cover(
     }
 
     // Build cover: (L \ Z) ∪ (R ∩ Z)
-    std::vector<uint8_t> cover(graph.number_of_vertices(), 0);
+    std::vector<uint8_t>& cover = cover_;
+    cover.assign(graph.number_of_vertices(), 0);
     for (EdgeId edge_id = 0;
             edge_id < graph.number_of_edges();
             ++edge_id) {
@@ -298,5 +323,36 @@ std::vector<uint8_t> optimizationtools::bipartite_graph_minimum_cover(
                 "maximum_matching_size: " + std::to_string(maximum_matching_size) + "; ");
     }
 
+    cover_is_computed_ = true;
     return cover;
 }
+
+std::vector<uint8_t> optimizationtools::bipartite_graph_maximum_matching(
+        const AdjacencyListGraph& graph)
+{
+    BipartiteGraph bipartite_graph(graph);
+    return bipartite_graph.maximum_matching();
+}
+
+std::vector<uint8_t> optimizationtools::bipartite_graph_maximum_matching(
+        const AdjacencyListGraph& graph,
+        const std::vector<uint8_t>& vertices_sides)
+{
+    BipartiteGraph bipartite_graph(graph, vertices_sides);
+    return bipartite_graph.maximum_matching();
+}
+
+std::vector<uint8_t> optimizationtools::bipartite_graph_minimum_cover(
+        const AdjacencyListGraph& graph)
+{
+    BipartiteGraph bipartite_graph(graph);
+    return bipartite_graph.minimum_cover();
+}
+
+std::vector<uint8_t> optimizationtools::bipartite_graph_minimum_cover(
+        const AdjacencyListGraph& graph,
+        const std::vector<uint8_t>& vertices_sides)
+{
+    BipartiteGraph bipartite_graph(graph, vertices_sides);
+    return bipartite_graph.minimum_cover();
+}
@@ -1,10 +1,21 @@
 #include "optimizationtools/graph/clique.hpp"
 
+#include "optimizationtools/graph/adjacency_matrix_graph.hpp"
+#include "optimizationtools/graph/clique_graph.hpp"
+#include "optimizationtools/graph/complement_graph_view.hpp"
+#include "optimizationtools/graph/compressed_graph.hpp"
+#include "optimizationtools/graph/k_core.hpp"
+
 //#include "optimizationtools/utils/common.hpp"
 #include "optimizationtools/containers/indexed_set.hpp"
 #include "optimizationtools/containers/indexed_4ary_heap.hpp"
+#include "optimizationtools/utils/radix_sort.hpp"
+#include "optimizationtools/utils/bits.hpp"
 
 #include <numeric>
+#include <thread>
+#include <atomic>
+#include <mutex>
 //#include <iostream>
 
 using namespace optimizationtools;
@@ -12,25 +23,88 @@ using namespace optimizationtools;
 namespace
 {
 
-inline void add_vertex_to_clique(
+/**
+ * Call 'function(neighbor_id)' for each neighbor of a vertex.
+ *
+ * Only an 'AdjacencyListGraph' has edge ids, so for the other graph types,
+ * 'edges_is_forbidden' must be 'nullptr'.
+ */
+template <typename Graph, typename Function>
+inline void for_each_allowed_neighbor(
+        const Graph& graph,
+        const std::vector<uint8_t>*,
+        VertexId vertex_id,
+        const Function& function)
+{
+    graph.for_each_neighbor(vertex_id, function);
+}
+
+/**
+ * Call 'function(neighbor_id)' for each neighbor of a vertex through a non
+ * forbidden edge.
+ */
+template <typename Function>
+inline void for_each_allowed_neighbor(
         const AdjacencyListGraph& graph,
+        const std::vector<uint8_t>* edges_is_forbidden,
+        VertexId vertex_id,
+        const Function& function)
+{
+    if (edges_is_forbidden == nullptr) {
+        graph.for_each_neighbor(vertex_id, function);
+        return;
+    }
+    for (const AdjacencyListGraph::VertexEdge& vertex_edge: graph.vertex(vertex_id).edges)
+        if ((*edges_is_forbidden)[vertex_edge.edge_id] == 0)
+            function(vertex_edge.vertex_id);
+}
+
+/**
+ * Start a clique from a vertex.
+ *
+ * The candidates are the neighbors of the vertex. They are added directly
+ * instead of filling the set and removing the non-neighbors, which would cost
+ * O(n).
+ */
+template <typename Graph>
+inline void initialize_clique(
+        const Graph& graph,
+        std::vector<VertexId>& clique,
+        const std::vector<uint8_t>* edges_is_forbidden,
+        VertexId vertex_id,
+        optimizationtools::IndexedSet& clique_candidates)
+{
+    clique.push_back(vertex_id);
+    clique_candidates.clear();
+    for_each_allowed_neighbor(
+            graph,
+            edges_is_forbidden,
+            vertex_id,
+            [&clique_candidates](VertexId neighbor_id)
+            {
+                clique_candidates.add(neighbor_id);
+            });
+}
+
+template <typename Graph>
+inline void add_vertex_to_clique(
+        const Graph& graph,
         std::vector<VertexId>& clique,
         const std::vector<uint8_t>* edges_is_forbidden,
         VertexId vertex_id,
         optimizationtools::IndexedSet& clique_candidates,
         optimizationtools::IndexedSet& edges_tmp)
 {
-    const AdjacencyListGraph::Vertex& vertex = graph.vertex(vertex_id);
     clique.push_back(vertex_id);
     edges_tmp.clear();
-    if (edges_is_forbidden == nullptr) {
-        for (const AdjacencyListGraph::VertexEdge& vertex_edge: vertex.edges)
-            edges_tmp.add(vertex_edge.vertex_id);
-    } else {
-        for (const AdjacencyListGraph::VertexEdge& vertex_edge: vertex.edges)
-            if ((*edges_is_forbidden)[vertex_edge.edge_id] == 0)
-                edges_tmp.add(vertex_edge.vertex_id);
-    }
+    for_each_allowed_neighbor(
+            graph,
+            edges_is_forbidden,
+            vertex_id,
+            [&edges_tmp](VertexId neighbor_id)
+            {
+                edges_tmp.add(neighbor_id);
+            });
     for (auto it = clique_candidates.begin(); it != clique_candidates.end();) {
         if (!edges_tmp.contains(*it)) {
             clique_candidates.remove(*it);
@@ -40,8 +114,9 @@ inline void add_vertex_to_clique(
     }
 }
 
+template <typename Graph>
 inline void fill_clique(
-        const AdjacencyListGraph& graph,
+        const Graph& graph,
         std::vector<VertexId>& clique,
         const std::vector<uint8_t>* edges_is_forbidden,
         optimizationtools::IndexedSet& clique_candidates,
@@ -52,18 +127,24 @@ inline void fill_clique(
         VertexId vertex_best_id = -1;
         Weight value_best = 0;
         for (VertexId vertex_id: clique_candidates) {
-            const AdjacencyListGraph::Vertex& vertex = graph.vertex(vertex_id);
             VertexId degree = 0;
-            for (const AdjacencyListGraph::VertexEdge& vertex_edge: vertex.edges)
-                if (clique_candidates.contains(vertex_edge.vertex_id))
-                    degree++;
-            //Weight value = vertex.weight;
-            //Weight value = vertex.weight * vertex.edges.size();
-            //Weight value = vertex.edges.size();
+            graph.for_each_neighbor(
+                    vertex_id,
+                    [&clique_candidates, &degree](VertexId neighbor_id)
+                    {
+                        if (clique_candidates.contains(neighbor_id))
+                            degree++;
+                    });
+            //Weight value = graph.weight(vertex_id);
+            //Weight value = graph.weight(vertex_id) * graph.degree(vertex_id);
+            //Weight value = graph.degree(vertex_id);
             //Weight value = degree;
-            Weight value = vertex.weight * degree;
+            Weight value = graph.weight(vertex_id) * degree;
+            // Ties are broken by vertex id so that the result doesn't depend
+            // on the order of the elements in 'clique_candidates'.
             if (vertex_best_id == -1
-                    || value_best < value) {
+                    || value_best < value
+                    || (value_best == value && vertex_best_id > vertex_id)) {
                 vertex_best_id = vertex_id;
                 value_best = value;
             }
@@ -80,40 +161,52 @@ inline void fill_clique(
 
 }
 
+template <typename Graph>
 std::vector<std::vector<VertexId>> optimizationtools::edge_clique_cover(
-        const AdjacencyListGraph& graph)
+        const Graph& graph)
 {
     std::vector<std::vector<VertexId>> clique_cover;
     optimizationtools::IndexedSet clique_candidates(graph.number_of_vertices());
     optimizationtools::IndexedSet edges_tmp(graph.number_of_vertices());
-    for (EdgeId edge_id = 0;
-            edge_id < graph.number_of_edges();
-            ++edge_id) {
-        const AdjacencyListGraph::Edge& edge = graph.edge(edge_id);
-        std::vector<VertexId> clique;
-        clique_candidates.fill();
-        add_vertex_to_clique(
-                graph,
-                clique,
-                nullptr,
-                edge.vertex_1_id,
-                clique_candidates,
-                edges_tmp);
-        add_vertex_to_clique(
-                graph,
-                clique,
-                nullptr,
-                edge.vertex_2_id,
-                clique_candidates,
-                edges_tmp);
-        fill_clique(
-                graph,
-                clique,
-                nullptr,
-                clique_candidates,
-                edges_tmp);
-        std::sort(clique.begin(), clique.end());
-        clique_cover.push_back(clique);
+    // Each edge is considered from its smallest end.
+    std::vector<VertexId> neighbors;
+    for (VertexId vertex_1_id = 0;
+            vertex_1_id < graph.number_of_vertices();
+            ++vertex_1_id) {
+        neighbors.clear();
+        graph.for_each_neighbor(
+                vertex_1_id,
+                [&neighbors, vertex_1_id](VertexId neighbor_id)
+                {
+                    if (neighbor_id > vertex_1_id)
+                        neighbors.push_back(neighbor_id);
+                });
+        for (VertexId vertex_2_id: neighbors) {
+            std::vector<VertexId> clique;
+            clique_candidates.fill();
+            add_vertex_to_clique(
+                    graph,
+                    clique,
+                    nullptr,
+                    vertex_1_id,
+                    clique_candidates,
+                    edges_tmp);
+            add_vertex_to_clique(
+                    graph,
+                    clique,
+                    nullptr,
+                    vertex_2_id,
+                    clique_candidates,
+                    edges_tmp);
+            fill_clique(
+                    graph,
+                    clique,
+                    nullptr,
+                    clique_candidates,
+                    edges_tmp);
+            std::sort(clique.begin(), clique.end());
+            clique_cover.push_back(clique);
+        }
     }
 
     // Remove duplicates.
@@ -125,34 +218,88 @@ std::vector<std::vector<VertexId>> optimizationtools::edge_clique_cover(
     return clique_cover;
 }
 
+template std::vector<std::vector<VertexId>> optimizationtools::edge_clique_cover(
+        const AbstractGraph&);
+template std::vector<std::vector<VertexId>> optimizationtools::edge_clique_cover(
+        const AdjacencyListGraph&);
+template std::vector<std::vector<VertexId>> optimizationtools::edge_clique_cover(
+        const AdjacencyMatrixGraph&);
+template std::vector<std::vector<VertexId>> optimizationtools::edge_clique_cover(
+        const CliqueGraph&);
+template std::vector<std::vector<VertexId>> optimizationtools::edge_clique_cover(
+        const ComplementGraphView&);
+template std::vector<std::vector<VertexId>> optimizationtools::edge_clique_cover(
+        const CompressedGraph&);
+
+template <typename Graph>
 std::vector<std::vector<VertexId>> optimizationtools::vertex_clique_cover(
-        const AdjacencyListGraph& graph)
+        const Graph& graph,
+        int number_of_threads)
 {
-    std::vector<std::vector<VertexId>> clique_cover;
-    optimizationtools::IndexedSet clique_candidates(graph.number_of_vertices());
-    optimizationtools::IndexedSet edges_tmp(graph.number_of_vertices());
-    for (VertexId vertex_id = 0;
-            vertex_id < graph.number_of_vertices();
-            ++vertex_id) {
-        std::vector<VertexId> clique;
-        clique_candidates.fill();
-        add_vertex_to_clique(
-                graph,
-                clique,
-                nullptr,
-                vertex_id,
-                clique_candidates,
-                edges_tmp);
-        fill_clique(
-                graph,
-                clique,
-                nullptr,
-                clique_candidates,
-                edges_tmp);
-        std::sort(clique.begin(), clique.end());
-        clique_cover.push_back(clique);
+    // The cost of building the clique of a vertex grows with its degree.
+    // Therefore, vertices are processed by non-increasing degree so that the
+    // most expensive ones are not left for the end.
+    std::vector<VertexId> sorted_vertices(graph.number_of_vertices());
+    std::iota(sorted_vertices.begin(), sorted_vertices.end(), 0);
+    std::stable_sort(
+            sorted_vertices.begin(),
+            sorted_vertices.end(),
+            [&graph](VertexId vertex_1_id, VertexId vertex_2_id) -> bool
+            {
+                return graph.degree(vertex_1_id) > graph.degree(vertex_2_id);
+            });
+
+    // For each vertex, its clique.
+    std::vector<std::vector<VertexId>> vertices_cliques(graph.number_of_vertices());
+
+    // Vertices are distributed dynamically to the threads by chunks.
+    const VertexPos chunk_size = 64;
+    std::atomic<VertexPos> next_pos(0);
+    auto build_cliques = [&graph, &sorted_vertices, &vertices_cliques, &next_pos, chunk_size]()
+    {
+        // Each thread has its own scratch sets.
+        optimizationtools::IndexedSet clique_candidates(graph.number_of_vertices());
+        optimizationtools::IndexedSet edges_tmp(graph.number_of_vertices());
+        for (;;) {
+            VertexPos pos_start = next_pos.fetch_add(chunk_size);
+            if (pos_start >= graph.number_of_vertices())
+                break;
+            VertexPos pos_end = (std::min)(
+                    pos_start + chunk_size,
+                    graph.number_of_vertices());
+            for (VertexPos pos = pos_start; pos < pos_end; ++pos) {
+                VertexId vertex_id = sorted_vertices[pos];
+                std::vector<VertexId>& clique = vertices_cliques[vertex_id];
+                initialize_clique(
+                        graph,
+                        clique,
+                        nullptr,
+                        vertex_id,
+                        clique_candidates);
+                fill_clique(
+                        graph,
+                        clique,
+                        nullptr,
+                        clique_candidates,
+                        edges_tmp);
+                std::sort(clique.begin(), clique.end());
+            }
+        }
+    };
+    if (number_of_threads <= 1) {
+        build_cliques();
+    } else {
+        std::vector<std::thread> threads;
+        for (int thread_id = 0; thread_id < number_of_threads; ++thread_id)
+            threads.push_back(std::thread(build_cliques));
+        for (std::thread& thread: threads)
+            thread.join();
     }
 
+    // The cliques don't depend on the thread which built them, and they are
+    // merged in vertex order, so the result is deterministic.
+    std::vector<std::vector<VertexId>> clique_cover = std::move(vertices_cliques);
+
     // Remove duplicates.
     std::sort(clique_cover.begin(), clique_cover.end());
     clique_cover.erase(
@@ -162,35 +309,46 @@ std::vector<std::vector<VertexId>> optimizationtools::vertex_clique_cover(
     return clique_cover;
 }
 
+template std::vector<std::vector<VertexId>> optimizationtools::vertex_clique_cover(
+        const AbstractGraph&, int);
+template std::vector<std::vector<VertexId>> optimizationtools::vertex_clique_cover(
+        const AdjacencyListGraph&, int);
+template std::vector<std::vector<VertexId>> optimizationtools::vertex_clique_cover(
+        const AdjacencyMatrixGraph&, int);
+template std::vector<std::vector<VertexId>> optimizationtools::vertex_clique_cover(
+        const CliqueGraph&, int);
+template std::vector<std::vector<VertexId>> optimizationtools::vertex_clique_cover(
+        const ComplementGraphView&, int);
+template std::vector<std::vector<VertexId>> optimizationtools::vertex_clique_cover(
+        const CompressedGraph&, int);
+
 std::vector<std::vector<VertexId>> optimizationtools::edge_clique_partition(
         const AdjacencyListGraph& graph)
 {
     std::vector<std::vector<VertexId>> cliques;
+
+    // Sort the edges by non-increasing weight with a radix sort on the
+    // weights. The sort is stable, so edges with the same weight are sorted by
+    // id.
+    std::vector<uint64_t> edges_keys(graph.number_of_edges());
     std::vector<EdgeId> sorted_edges(graph.number_of_edges());
-    std::iota(sorted_edges.begin(), sorted_edges.end(), 0);
-    std::sort(
-            sorted_edges.begin(),
-            sorted_edges.end(),
-            [&graph](EdgeId edge_1_id, EdgeId edge_2_id) -> bool
-            {
-                const AdjacencyListGraph::Edge& edge_1 = graph.edge(edge_1_id);
-                const AdjacencyListGraph::Edge& edge_2 = graph.edge(edge_2_id);
-                const AdjacencyListGraph::Vertex& vertex_1_1 = graph.vertex(edge_1.vertex_1_id);
-                const AdjacencyListGraph::Vertex& vertex_1_2 = graph.vertex(edge_1.vertex_2_id);
-                const AdjacencyListGraph::Vertex& vertex_2_1 = graph.vertex(edge_2.vertex_1_id);
-                const AdjacencyListGraph::Vertex& vertex_2_2 = graph.vertex(edge_2.vertex_2_id);
-
-                Weight v1 = (vertex_1_1.weight + vertex_1_2.weight);
-                Weight v2 = (vertex_2_1.weight + vertex_2_2.weight);
-                //Weight v1 = (vertex_1_1.weight + vertex_1_2.weight) * (vertex_1_1.edges.size() + vertex_1_2.edges.size());
-                //Weight v2 = (vertex_2_1.weight + vertex_2_2.weight) * (vertex_2_1.edges.size() + vertex_2_2.edges.size());
-                //Weight v1 = (vertex_1_1.edges.size() + vertex_1_2.edges.size());
-                //Weight v2 = (vertex_2_1.edges.size() + vertex_2_2.edges.size());
-                return v1 > v2;
-            });
+    for (EdgeId edge_id = 0;
+            edge_id < graph.number_of_edges();
+            ++edge_id) {
+        const AdjacencyListGraph::Edge& edge = graph.edge(edge_id);
+        Weight value = graph.weight(edge.vertex_1_id) + graph.weight(edge.vertex_2_id);
+        //Weight value = (graph.weight(edge.vertex_1_id) + graph.weight(edge.vertex_2_id)) * (graph.degree(edge.vertex_1_id) + graph.degree(edge.vertex_2_id));
+        //Weight value = graph.degree(edge.vertex_1_id) + graph.degree(edge.vertex_2_id);
+        edges_keys[edge_id] = ~radix_sort_key(value);
+        sorted_edges[edge_id] = edge_id;
+    }
+    radix_sort(edges_keys, sorted_edges);
+
     std::vector<uint8_t> edges_is_selected(graph.number_of_edges(), 0);
     optimizationtools::IndexedSet clique_candidates(graph.number_of_vertices());
     optimizationtools::IndexedSet edges_tmp(graph.number_of_vertices());
+    // Clique being built. It is reused from one iteration to the other.
+    std::vector<VertexId> clique;
     for (EdgeId edge_pos = 0;
             edge_pos < graph.number_of_edges();
             ++edge_pos) {
@@ -199,15 +357,13 @@ std::vector<std::vector<VertexId>> optimizationtools::edge_clique_partition(
             continue;
         const AdjacencyListGraph::Edge& edge = graph.edge(edge_id);
 
-        std::vector<VertexId> clique;
-        clique_candidates.fill();
-        add_vertex_to_clique(
+        clique.clear();
+        initialize_clique(
                 graph,
                 clique,
                 &edges_is_selected,
                 edge.vertex_1_id,
-                clique_candidates,
-                edges_tmp);
+                clique_candidates);
         add_vertex_to_clique(
                 graph,
                 clique,
@@ -233,62 +389,95 @@ std::vector<std::vector<VertexId>> optimizationtools::edge_clique_partition(
                     edges_is_selected[edge.edge_id] = 1;
         }
 
-        cliques.push_back(clique);
+        cliques.emplace_back(clique.begin(), clique.end());
     }
 
     return cliques;
 }
 
+template <typename Graph>
 std::vector<std::vector<VertexId>> optimizationtools::vertex_clique_partition_1(
-        const AdjacencyListGraph& graph)
+        const Graph& graph)
 {
     std::vector<std::vector<VertexId>> cliques;
     std::vector<Weight> cliques_weights;
 
-    optimizationtools::IndexedSet vertex_edges(graph.number_of_edges());
+    // For each vertex already processed, the id of its clique.
+    std::vector<VertexId> vertices_cliques(graph.number_of_vertices(), -1);
+
+    // For each clique, the number of neighbors of the current vertex it
+    // contains. A clique is compatible with the current vertex iff this
+    // number is equal to its size.
+    std::vector<VertexPos> cliques_number_of_neighbors;
+    std::vector<VertexId> neighbor_cliques;
+
+    // For each vertex, the last vertex for which it has been counted as a
+    // neighbor. This avoids counting duplicate edges twice.
+    std::vector<VertexId> vertices_last_counted(graph.number_of_vertices(), -1);
+
     for (VertexId vertex_id = 0;
             vertex_id < graph.number_of_vertices();
             ++vertex_id) {
-        const AdjacencyListGraph::Vertex& vertex = graph.vertex(vertex_id);
-
-        vertex_edges.clear();
-        for (const AdjacencyListGraph::VertexEdge& vertex_edge: vertex.edges)
-            vertex_edges.add(vertex_edge.vertex_id);
+        // Count the neighbors of the vertex in each clique.
+        neighbor_cliques.clear();
+        graph.for_each_neighbor(
+                vertex_id,
+                [&](VertexId neighbor_id)
+                {
+                    VertexId clique_id = vertices_cliques[neighbor_id];
+                    if (clique_id == -1)
+                        return;
+                    if (vertices_last_counted[neighbor_id] == vertex_id)
+                        return;
+                    vertices_last_counted[neighbor_id] = vertex_id;
+                    if (cliques_number_of_neighbors[clique_id] == 0)
+                        neighbor_cliques.push_back(clique_id);
+                    cliques_number_of_neighbors[clique_id]++;
+                });
 
+        // Find the compatible clique with the highest weight. Ties are broken
+        // by clique id.
         VertexId clique_id_best = -1;
-        for (VertexId clique_id = 0;
-                clique_id < (VertexId)cliques.size();
-                ++clique_id) {
-            const std::vector<VertexId>& clique = cliques[clique_id];
-            Weight clique_weight = cliques_weights[clique_id];
-
-            bool ok = true;
-            for (VertexId clique_vertex_id: clique) {
-                if (!vertex_edges.contains(clique_vertex_id)) {
-                    ok = false;
-                    break;
+        for (VertexId clique_id: neighbor_cliques) {
+            if (cliques_number_of_neighbors[clique_id]
+                    == (VertexPos)cliques[clique_id].size()) {
+                if (clique_id_best == -1
+                        || cliques_weights[clique_id_best] < cliques_weights[clique_id]
+                        || (cliques_weights[clique_id_best] == cliques_weights[clique_id]
+                            && clique_id_best > clique_id)) {
+                    clique_id_best = clique_id;
                 }
             }
-            if (!ok)
-                continue;
-
-            if (clique_id_best == -1
-                    || cliques_weights[clique_id_best] < clique_weight) {
-                clique_id_best = clique_id;
-            }
+            cliques_number_of_neighbors[clique_id] = 0;
         }
 
         if (clique_id_best != -1) {
             cliques[clique_id_best].push_back(vertex_id);
-            cliques_weights[clique_id_best] += vertex.weight;
+            cliques_weights[clique_id_best] += graph.weight(vertex_id);
         } else {
+            clique_id_best = cliques.size();
             cliques.push_back({vertex_id});
-            cliques_weights.push_back({vertex.weight});
+            cliques_weights.push_back(graph.weight(vertex_id));
+            cliques_number_of_neighbors.push_back(0);
         }
+        vertices_cliques[vertex_id] = clique_id_best;
     }
     return cliques;
 }
 
+template std::vector<std::vector<VertexId>> optimizationtools::vertex_clique_partition_1(
+        const AbstractGraph&);
+template std::vector<std::vector<VertexId>> optimizationtools::vertex_clique_partition_1(
+        const AdjacencyListGraph&);
+template std::vector<std::vector<VertexId>> optimizationtools::vertex_clique_partition_1(
+        const AdjacencyMatrixGraph&);
+template std::vector<std::vector<VertexId>> optimizationtools::vertex_clique_partition_1(
+        const CliqueGraph&);
+template std::vector<std::vector<VertexId>> optimizationtools::vertex_clique_partition_1(
+        const ComplementGraphView&);
+template std::vector<std::vector<VertexId>> optimizationtools::vertex_clique_partition_1(
+        const CompressedGraph&);
+
 std::vector<std::vector<VertexId>> optimizationtools::vertex_clique_partition_2(
         const AdjacencyListGraph& graph)
 {
@@ -441,3 +630,446 @@ std::vector<std::vector<VertexId>> optimizationtools::vertex_clique_partition_2(
 
     return cliques;
 }
+
+namespace
+{
+
+/**
+ * Subproblem of the maximum-weight clique algorithm: the cliques made of a
+ * root vertex and of its neighbors which are after it in the degeneracy
+ * ordering.
+ *
+ * The candidates are numbered from 0 and their adjacency matrix is stored
+ * row by row, each row being a bitset of 'number_of_words' words.
+ */
+struct MaximumWeightCliqueSubproblem
+{
+    /** Root vertex. */
+    VertexId root_vertex_id = -1;
+
+    /** For each candidate, its id in the graph. */
+    std::vector<VertexId> vertex_ids;
+
+    /** For each candidate, its weight. */
+    std::vector<Weight> weights;
+
+    /** Number of words of a bitset. */
+    VertexPos number_of_words = 0;
+
+    /** Adjacency matrix of the candidates. */
+    std::vector<uint64_t> adjacency_matrix;
+
+    inline const uint64_t* row(VertexPos vertex_pos) const { return adjacency_matrix.data() + vertex_pos * number_of_words; }
+};
+
+/**
+ * Data shared by the threads of the maximum-weight clique algorithm.
+ */
+struct MaximumWeightCliqueSharedData
+{
+    /** Graph. */
+    const AdjacencyListGraph* graph;
+
+    /** Parameters. */
+    const MaximumWeightCliqueParameters* parameters;
+
+    /** For each vertex, its neighbors after it in the degeneracy ordering. */
+    std::vector<std::vector<VertexId>> forward_neighbors;
+
+    /**
+     * Root vertices of the subproblems, in reverse degeneracy ordering.
+     */
+    std::vector<VertexId> subproblems_root_vertices;
+
+    /** For each subproblem, an upper bound on the weight of its cliques. */
+    std::vector<Weight> subproblems_bounds;
+
+    /** For each subproblem, 'true' iff it has been solved or skipped. */
+    std::vector<char> subproblems_are_solved;
+
+    /** Id of the next subproblem to solve. */
+    std::atomic<VertexPos> next_subproblem_id;
+
+    /** Weight of the best clique found, read without locking. */
+    std::atomic<Weight> lower_bound;
+
+    /** 'true' iff the algorithm needs to end. */
+    std::atomic<bool> end;
+
+    /** Mutex protecting the output. */
+    std::mutex output_mutex;
+
+    /** Output. */
+    MaximumWeightCliqueOutput* output;
+};
+
+/**
+ * Solver of the subproblems of the maximum-weight clique algorithm. Each
+ * thread owns one.
+ */
+class MaximumWeightCliqueSearch
+{
+
+public:
+
+    /** Constructor. */
+    MaximumWeightCliqueSearch(MaximumWeightCliqueSharedData& data):
+        data_(data),
+        local_ids_(data.graph->number_of_vertices(), -1) { }
+
+    /** Solve subproblems until there are none left. */
+    void run();
+
+    /** Get the number of nodes. */
+    inline Counter number_of_nodes() const { return number_of_nodes_; }
+
+private:
+
+    /** Build the subproblem of a root vertex. */
+    void build_subproblem(VertexId root_vertex_id);
+
+    /** Explore a node. Return 'false' iff the search has been interrupted. */
+    bool expand(
+            VertexPos depth,
+            Weight clique_weight);
+
+    /** Update the best clique with the current clique if it is better. */
+    void update_best_clique(Weight clique_weight);
+
+    /** Shared data. */
+    MaximumWeightCliqueSharedData& data_;
+
+    /** For each vertex, its id in the current subproblem, '-1' if none. */
+    std::vector<VertexPos> local_ids_;
+
+    /** Current subproblem. */
+    MaximumWeightCliqueSubproblem subproblem_;
+
+    /** Current clique, without the root vertex. */
+    std::vector<VertexPos> clique_;
+
+    /** For each depth, the bitset of the candidates. */
+    std::vector<std::vector<uint64_t>> candidates_;
+
+    /** For each depth, the candidates in coloring order. */
+    std::vector<std::vector<VertexPos>> colored_vertices_;
+
+    /**
+     * For each depth and each position in 'colored_vertices_', an upper
+     * bound on the weight of a clique of the candidates up to this position.
+     */
+    std::vector<std::vector<Weight>> colored_vertices_bounds_;
+
+    /** Bitsets used by the coloring. */
+    std::vector<uint64_t> uncolored_;
+    std::vector<uint64_t> colorable_;
+
+    /** Number of nodes. */
+    Counter number_of_nodes_ = 0;
+
+};
+
+inline VertexPos first_bit(
+        const uint64_t* bitset,
+        VertexPos number_of_words)
+{
+    for (VertexPos word_pos = 0; word_pos < number_of_words; ++word_pos)
+        if (bitset[word_pos] != 0)
+            return word_pos * 64 + lowest_bit(bitset[word_pos]);
+    return -1;
+}
+
+void MaximumWeightCliqueSearch::build_subproblem(VertexId root_vertex_id)
+{
+    const std::vector<VertexId>& candidates = data_.forward_neighbors[root_vertex_id];
+    VertexPos number_of_candidates = candidates.size();
+    subproblem_.root_vertex_id = root_vertex_id;
+    subproblem_.vertex_ids = candidates;
+    subproblem_.weights.resize(number_of_candidates);
+    subproblem_.number_of_words = (number_of_candidates + 63) / 64;
+    subproblem_.adjacency_matrix.assign(
+            number_of_candidates * subproblem_.number_of_words,
+            0);
+    for (VertexPos vertex_pos = 0;
+            vertex_pos < number_of_candidates;
+            ++vertex_pos) {
+        local_ids_[candidates[vertex_pos]] = vertex_pos;
+        subproblem_.weights[vertex_pos] = data_.graph->weight(candidates[vertex_pos]);
+    }
+    // Each edge between two candidates is in the forward neighbors of one of
+    // its ends.
+    for (VertexPos vertex_pos = 0;
+            vertex_pos < number_of_candidates;
+            ++vertex_pos) {
+        for (VertexId neighbor_id: data_.forward_neighbors[candidates[vertex_pos]]) {
+            VertexPos neighbor_pos = local_ids_[neighbor_id];
+            if (neighbor_pos == -1)
+                continue;
+            subproblem_.adjacency_matrix[vertex_pos * subproblem_.number_of_words + neighbor_pos / 64]
+                |= (uint64_t)1 << (neighbor_pos % 64);
+            subproblem_.adjacency_matrix[neighbor_pos * subproblem_.number_of_words + vertex_pos / 64]
+                |= (uint64_t)1 << (vertex_pos % 64);
+        }
+    }
+    for (VertexId vertex_id: candidates)
+        local_ids_[vertex_id] = -1;
+
+    // Resize the buffers of the search.
+    if ((VertexPos)candidates_.size() < number_of_candidates + 1) {
+        candidates_.resize(number_of_candidates + 1);
+        colored_vertices_.resize(number_of_candidates + 1);
+        colored_vertices_bounds_.resize(number_of_candidates + 1);
+    }
+    for (VertexPos depth = 0; depth <= number_of_candidates; ++depth)
+        candidates_[depth].resize(subproblem_.number_of_words);
+    uncolored_.resize(subproblem_.number_of_words);
+    colorable_.resize(subproblem_.number_of_words);
+
+    // All the candidates are candidates of the root node.
+    std::fill(candidates_[0].begin(), candidates_[0].end(), 0);
+    for (VertexPos vertex_pos = 0;
+            vertex_pos < number_of_candidates;
+            ++vertex_pos) {
+        candidates_[0][vertex_pos / 64] |= (uint64_t)1 << (vertex_pos % 64);
+    }
+}
+
+void MaximumWeightCliqueSearch::update_best_clique(Weight clique_weight)
+{
+    std::lock_guard<std::mutex> lock(data_.output_mutex);
+    MaximumWeightCliqueOutput& output = *data_.output;
+    if (clique_weight <= output.weight)
+        return;
+    output.clique = {subproblem_.root_vertex_id};
+    for (VertexPos vertex_pos: clique_)
+        output.clique.push_back(subproblem_.vertex_ids[vertex_pos]);
+    output.weight = clique_weight;
+    data_.lower_bound = clique_weight;
+}
+
+bool MaximumWeightCliqueSearch::expand(
+        VertexPos depth,
+        Weight clique_weight)
+{
+    number_of_nodes_++;
+    if (number_of_nodes_ % 1024 == 0
+            && data_.parameters->timer.needs_to_end()) {
+        data_.end = true;
+    }
+    if (data_.end)
+        return false;
+
+    if (clique_weight > data_.lower_bound)
+        update_best_clique(clique_weight);
+
+    // Greedy coloring of the candidates. A clique contains at most one
+    // vertex of each color class, so the sum of the largest weights of the
+    // color classes of the candidates up to a position is an upper bound.
+    VertexPos number_of_words = subproblem_.number_of_words;
+    std::vector<VertexPos>& colored_vertices = colored_vertices_[depth];
+    std::vector<Weight>& colored_vertices_bounds = colored_vertices_bounds_[depth];
+    colored_vertices.clear();
+    colored_vertices_bounds.clear();
+    std::copy(candidates_[depth].begin(), candidates_[depth].end(), uncolored_.begin());
+    Weight bound = 0;
+    for (;;) {
+        VertexPos vertex_pos = first_bit(uncolored_.data(), number_of_words);
+        if (vertex_pos == -1)
+            break;
+        std::copy(uncolored_.begin(), uncolored_.end(), colorable_.begin());
+        Weight color_class_weight = 0;
+        while (vertex_pos != -1) {
+            colored_vertices.push_back(vertex_pos);
+            color_class_weight = (std::max)(color_class_weight, subproblem_.weights[vertex_pos]);
+            uncolored_[vertex_pos / 64] &= ~((uint64_t)1 << (vertex_pos % 64));
+            const uint64_t* row = subproblem_.row(vertex_pos);
+            for (VertexPos word_pos = vertex_pos / 64;
+                    word_pos < number_of_words;
+                    ++word_pos) {
+                colorable_[word_pos] &= ~row[word_pos];
+            }
+            colorable_[vertex_pos / 64] &= ~((uint64_t)1 << (vertex_pos % 64));
+            vertex_pos = first_bit(colorable_.data(), number_of_words);
+        }
+        bound += color_class_weight;
+        colored_vertices_bounds.resize(colored_vertices.size(), bound);
+    }
+
+    // Branch on the candidates, starting from the last colored ones.
+    std::vector<uint64_t>& candidates = candidates_[depth];
+    std::vector<uint64_t>& next_candidates = candidates_[depth + 1];
+    for (VertexPos pos = (VertexPos)colored_vertices.size() - 1; pos >= 0; --pos) {
+        if (clique_weight + colored_vertices_bounds[pos] <= data_.lower_bound)
+            break;
+        VertexPos vertex_pos = colored_vertices[pos];
+        const uint64_t* row = subproblem_.row(vertex_pos);
+        for (VertexPos word_pos = 0; word_pos < number_of_words; ++word_pos)
+            next_candidates[word_pos] = candidates[word_pos] & row[word_pos];
+        clique_.push_back(vertex_pos);
+        bool completed = expand(depth + 1, clique_weight + subproblem_.weights[vertex_pos]);
+        clique_.pop_back();
+        if (!completed)
+            return false;
+        candidates[vertex_pos / 64] &= ~((uint64_t)1 << (vertex_pos % 64));
+    }
+    return true;
+}
+
+void MaximumWeightCliqueSearch::run()
+{
+    VertexPos number_of_subproblems = data_.subproblems_root_vertices.size();
+    for (;;) {
+        if (data_.parameters->timer.needs_to_end())
+            data_.end = true;
+        if (data_.end)
+            return;
+        VertexPos subproblem_id = data_.next_subproblem_id++;
+        if (subproblem_id >= number_of_subproblems)
+            return;
+        if (data_.subproblems_bounds[subproblem_id] <= data_.lower_bound) {
+            data_.subproblems_are_solved[subproblem_id] = 1;
+            continue;
+        }
+        VertexId root_vertex_id = data_.subproblems_root_vertices[subproblem_id];
+        build_subproblem(root_vertex_id);
+        clique_.clear();
+        if (expand(0, data_.graph->weight(root_vertex_id)))
+            data_.subproblems_are_solved[subproblem_id] = 1;
+    }
+}
+
+}
+
+MaximumWeightCliqueOutput optimizationtools::maximum_weight_clique(
+        const AdjacencyListGraph& graph,
+        const MaximumWeightCliqueParameters& parameters)
+{
+    MaximumWeightCliqueOutput output;
+    std::unique_ptr<optimizationtools::ComposeStream> os = parameters.create_os();
+    if (parameters.verbosity_level >= 1) {
+        *os
+            << "=================================" << std::endl
+            << "       Maximum-weight clique     " << std::endl
+            << "=================================" << std::endl
+            << std::endl
+            << "Graph" << std::endl
+            << "-----" << std::endl
+            << "Number of vertices:     " << graph.number_of_vertices() << std::endl
+            << "Number of edges:        " << graph.number_of_edges() << std::endl
+            << std::endl
+            << "Parameters" << std::endl
+            << "----------" << std::endl;
+        parameters.format(*os);
+        *os << std::endl;
+    }
+
+    VertexId number_of_vertices = graph.number_of_vertices();
+    CoreDecomposition core_decomposition = optimizationtools::core_decomposition(graph);
+    std::vector<VertexPos> positions(number_of_vertices);
+    for (VertexPos pos = 0; pos < number_of_vertices; ++pos)
+        positions[core_decomposition.ordering[pos]] = pos;
+
+    MaximumWeightCliqueSharedData data;
+    data.graph = &graph;
+    data.parameters = &parameters;
+    data.output = &output;
+    data.next_subproblem_id = 0;
+    data.lower_bound = 0;
+    data.end = false;
+
+    // Neighbors after each vertex in the degeneracy ordering, without the
+    // vertices with a non-positive weight.
+    data.forward_neighbors.resize(number_of_vertices);
+    for (VertexId vertex_id = 0; vertex_id < number_of_vertices; ++vertex_id) {
+        if (graph.weight(vertex_id) <= 0)
+            continue;
+        std::vector<VertexId>& forward_neighbors = data.forward_neighbors[vertex_id];
+        for (VertexId neighbor_id: graph.vertex(vertex_id).neighbors) {
+            if (positions[neighbor_id] > positions[vertex_id]
+                    && graph.weight(neighbor_id) > 0) {
+                forward_neighbors.push_back(neighbor_id);
+            }
+        }
+        std::sort(forward_neighbors.begin(), forward_neighbors.end());
+        forward_neighbors.erase(
+                std::unique(forward_neighbors.begin(), forward_neighbors.end()),
+                forward_neighbors.end());
+    }
+
+    // Initial solution: add the vertices greedily, starting from the end of
+    // the degeneracy ordering.
+    {
+        std::vector<VertexId> candidates;
+        for (VertexPos pos = number_of_vertices - 1; pos >= 0; --pos)
+            if (graph.weight(core_decomposition.ordering[pos]) > 0)
+                candidates.push_back(core_decomposition.ordering[pos]);
+        std::vector<char> is_neighbor(number_of_vertices, 0);
+        while (!candidates.empty()) {
+            VertexId vertex_id = candidates.front();
+            output.clique.push_back(vertex_id);
+            output.weight += graph.weight(vertex_id);
+            for (VertexId neighbor_id: graph.vertex(vertex_id).neighbors)
+                is_neighbor[neighbor_id] = 1;
+            VertexPos number_of_candidates = 0;
+            for (VertexId candidate_id: candidates)
+                if (is_neighbor[candidate_id])
+                    candidates[number_of_candidates++] = candidate_id;
+            candidates.resize(number_of_candidates);
+            for (VertexId neighbor_id: graph.vertex(vertex_id).neighbors)
+                is_neighbor[neighbor_id] = 0;
+        }
+        data.lower_bound = output.weight;
+    }
+
+    // Subproblems.
+    for (VertexPos pos = number_of_vertices - 1; pos >= 0; --pos) {
+        VertexId vertex_id = core_decomposition.ordering[pos];
+        if (graph.weight(vertex_id) <= 0)
+            continue;
+        Weight bound = graph.weight(vertex_id);
+        for (VertexId neighbor_id: data.forward_neighbors[vertex_id])
+            bound += graph.weight(neighbor_id);
+        data.subproblems_root_vertices.push_back(vertex_id);
+        data.subproblems_bounds.push_back(bound);
+    }
+    data.subproblems_are_solved.resize(data.subproblems_root_vertices.size(), 0);
+
+    std::vector<MaximumWeightCliqueSearch> searches(
+            (std::max)(parameters.number_of_threads, 1),
+            MaximumWeightCliqueSearch(data));
+    if (parameters.number_of_threads <= 1) {
+        searches[0].run();
+    } else {
+        std::vector<std::thread> threads;
+        for (int thread_id = 0; thread_id < parameters.number_of_threads; ++thread_id)
+            threads.push_back(std::thread(&MaximumWeightCliqueSearch::run, &searches[thread_id]));
+        for (std::thread& thread: threads)
+            thread.join();
+    }
+
+    output.bound = output.weight;
+    for (VertexPos subproblem_id = 0;
+            subproblem_id < (VertexPos)data.subproblems_root_vertices.size();
+            ++subproblem_id) {
+        if (!data.subproblems_are_solved[subproblem_id])
+            output.bound = (std::max)(output.bound, data.subproblems_bounds[subproblem_id]);
+    }
+    for (const MaximumWeightCliqueSearch& search: searches)
+        output.number_of_nodes += search.number_of_nodes();
+    output.time = parameters.timer.elapsed_time();
+
+    output.json["Weight"] = output.weight;
+    output.json["Bound"] = output.bound;
+    output.json["NumberOfNodes"] = output.number_of_nodes;
+    output.json["Time"] = output.time;
+    if (parameters.verbosity_level >= 1) {
+        *os
+            << "Final statistics" << std::endl
+            << "----------------" << std::endl
+            << "Weight:                 " << output.weight << std::endl
+            << "Bound:                  " << output.bound << std::endl
+            << "Number of nodes:        " << output.number_of_nodes << std::endl
+            << "Time (s):               " << output.time << std::endl;
+    }
+    return output;
+}
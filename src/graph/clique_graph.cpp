@@ -96,3 +96,28 @@ void CliqueGraphBuilder::set_weight(
 {
     graph_.vertices_[vertex_id].weight = weight;
 };
+
+void CliqueGraphBuilder::compute_neighbors()
+{
+    // The neighbors are computed from the cliques, therefore, they are moved
+    // into the graph only at the end.
+    VertexId number_of_vertices = graph_.number_of_vertices();
+    std::vector<EdgeId> neighbors_offsets(number_of_vertices + 1, 0);
+    std::vector<VertexId> neighbors;
+    optimizationtools::IndexedSet neighbors_tmp(number_of_vertices);
+    for (VertexId vertex_id = 0;
+            vertex_id < number_of_vertices;
+            ++vertex_id) {
+        graph_.for_each_neighbor(
+                vertex_id,
+                [&neighbors](VertexId neighbor_id) { neighbors.push_back(neighbor_id); },
+                neighbors_tmp);
+        std::sort(
+                neighbors.begin() + neighbors_offsets[vertex_id],
+                neighbors.end());
+        neighbors_offsets[vertex_id + 1] = neighbors.size();
+    }
+    neighbors.shrink_to_fit();
+    graph_.neighbors_offsets_ = std::move(neighbors_offsets);
+    graph_.neighbors_ = std::move(neighbors);
+}
@@ -0,0 +1,156 @@
+#include "optimizationtools/graph/clique_partition_reduction.hpp"
+
+#include "optimizationtools/utils/timer.hpp"
+
+#include <algorithm>
+#include <iomanip>
+
+using namespace optimizationtools;
+
+VertexCliquePartitionReduction::VertexCliquePartitionReduction(
+        const AdjacencyListGraph& graph,
+        VertexPos maximum_domination_degree):
+    number_of_vertices_(graph.number_of_vertices()),
+    number_of_edges_(graph.number_of_edges()),
+    graph_(graph),
+    worklist_(graph.number_of_vertices()),
+    kernel_(reduce(maximum_domination_degree))
+{
+}
+
+void VertexCliquePartitionReduction::remove_vertex(VertexId vertex_id)
+{
+    graph_.for_each_neighbor(
+            vertex_id,
+            [this](VertexId neighbor_id) { worklist_.add(neighbor_id); });
+    graph_.remove_vertex(vertex_id);
+}
+
+bool VertexCliquePartitionReduction::reduce_domination(VertexId vertex_id)
+{
+    neighbors_tmp_.clear();
+    graph_.for_each_neighbor(
+            vertex_id,
+            [this](VertexId neighbor_id) { neighbors_tmp_.push_back(neighbor_id); });
+    std::sort(neighbors_tmp_.begin(), neighbors_tmp_.end());
+    neighbors_tmp_.erase(
+            std::unique(neighbors_tmp_.begin(), neighbors_tmp_.end()),
+            neighbors_tmp_.end());
+
+    // A neighbor dominating the vertex is adjacent to all its other
+    // neighbors, so its degree is at least the number of its neighbors.
+    for (VertexId neighbor_id: neighbors_tmp_) {
+        if (graph_.degree(neighbor_id) < (VertexPos)neighbors_tmp_.size())
+            continue;
+        bool dominates = true;
+        for (VertexId neighbor_2_id: neighbors_tmp_) {
+            if (neighbor_2_id != neighbor_id
+                    && !graph_.has_edge(neighbor_id, neighbor_2_id)) {
+                dominates = false;
+                break;
+            }
+        }
+        if (!dominates)
+            continue;
+        reductions_.push_back({Rule::Domination, neighbor_id, vertex_id});
+        number_of_removed_vertices_[(int)Rule::Domination]++;
+        remove_vertex(neighbor_id);
+        return true;
+    }
+    return false;
+}
+
+AdjacencyListGraph VertexCliquePartitionReduction::reduce(
+        VertexPos maximum_domination_degree)
+{
+    Timer timer;
+    worklist_.fill();
+    while (!worklist_.empty()) {
+        VertexId vertex_id = *(worklist_.end() - 1);
+        worklist_.remove(vertex_id);
+        if (!graph_.contains(vertex_id))
+            continue;
+
+        VertexPos degree = graph_.degree(vertex_id);
+        if (degree == 0) {
+            reductions_.push_back({Rule::Isolated, vertex_id, -1});
+            number_of_removed_vertices_[(int)Rule::Isolated]++;
+            number_of_cliques_++;
+            graph_.remove_vertex(vertex_id);
+        } else if (degree == 1) {
+            VertexId neighbor_id = graph_.edges(vertex_id).front().vertex_id;
+            reductions_.push_back({Rule::Pendant, vertex_id, neighbor_id});
+            number_of_removed_vertices_[(int)Rule::Pendant] += 2;
+            number_of_cliques_++;
+            remove_vertex(neighbor_id);
+            graph_.remove_vertex(vertex_id);
+        } else if (degree <= maximum_domination_degree) {
+            reduce_domination(vertex_id);
+        }
+    }
+    AdjacencyListGraph kernel = graph_.compact(original_vertex_ids_);
+    time_ = timer.elapsed_time();
+    return kernel;
+}
+
+std::vector<std::vector<VertexId>> VertexCliquePartitionReduction::lift(
+        const std::vector<std::vector<VertexId>>& kernel_cliques) const
+{
+    std::vector<std::vector<VertexId>> cliques;
+    cliques.reserve(kernel_cliques.size() + number_of_cliques_);
+    // For each vertex of the original graph, the position of its clique.
+    std::vector<VertexPos> vertices_cliques(number_of_vertices_, -1);
+    for (const std::vector<VertexId>& kernel_clique: kernel_cliques) {
+        std::vector<VertexId> clique;
+        for (VertexId kernel_vertex_id: kernel_clique) {
+            VertexId vertex_id = original_vertex_ids_[kernel_vertex_id];
+            vertices_cliques[vertex_id] = cliques.size();
+            clique.push_back(vertex_id);
+        }
+        cliques.push_back(clique);
+    }
+
+    for (auto it = reductions_.rbegin(); it != reductions_.rend(); ++it) {
+        const Reduction& reduction = *it;
+        switch (reduction.rule) {
+        case Rule::Isolated: {
+            vertices_cliques[reduction.vertex_id] = cliques.size();
+            cliques.push_back({reduction.vertex_id});
+            break;
+        } case Rule::Pendant: {
+            vertices_cliques[reduction.vertex_id] = cliques.size();
+            vertices_cliques[reduction.vertex_2_id] = cliques.size();
+            cliques.push_back({reduction.vertex_id, reduction.vertex_2_id});
+            break;
+        } case Rule::Domination: {
+            VertexPos clique_pos = vertices_cliques[reduction.vertex_2_id];
+            if (clique_pos == -1) {
+                throw std::invalid_argument(
+                        "optimizationtools::VertexCliquePartitionReduction::lift: "
+                        "vertex " + std::to_string(reduction.vertex_2_id)
+                        + " doesn't belong to any clique.");
+            }
+            vertices_cliques[reduction.vertex_id] = clique_pos;
+            cliques[clique_pos].push_back(reduction.vertex_id);
+            break;
+        }
+        }
+    }
+    return cliques;
+}
+
+void VertexCliquePartitionReduction::format(std::ostream& os) const
+{
+    int width = 31;
+    os
+        << std::setw(width) << std::left << "Number of vertices: " << number_of_vertices_ << std::endl
+        << std::setw(width) << std::left << "Number of edges: " << number_of_edges_ << std::endl
+        << std::setw(width) << std::left << "Kernel number of vertices: " << kernel_.number_of_vertices() << std::endl
+        << std::setw(width) << std::left << "Kernel number of edges: " << kernel_.number_of_edges() << std::endl
+        << std::setw(width) << std::left << "Isolated vertices removed: " << number_of_removed_vertices(Rule::Isolated) << std::endl
+        << std::setw(width) << std::left << "Pendant vertices removed: " << number_of_removed_vertices(Rule::Pendant) << std::endl
+        << std::setw(width) << std::left << "Dominating vertices removed: " << number_of_removed_vertices(Rule::Domination) << std::endl
+        << std::setw(width) << std::left << "Number of cliques: " << number_of_cliques_ << std::endl
+        << std::setw(width) << std::left << "Time (s): " << time_ << std::endl
+        ;
+}
@@ -0,0 +1,270 @@
+#include "optimizationtools/graph/coloring.hpp"
+
+#include "optimizationtools/graph/adjacency_matrix_graph.hpp"
+#include "optimizationtools/graph/clique_graph.hpp"
+#include "optimizationtools/graph/complement_graph_view.hpp"
+#include "optimizationtools/graph/compressed_graph.hpp"
+#include "optimizationtools/graph/k_core.hpp"
+
+#include "optimizationtools/containers/indexed_set.hpp"
+#include "optimizationtools/utils/bits.hpp"
+
+#include <algorithm>
+
+using namespace optimizationtools;
+
+namespace
+{
+
+/** Get the position of the first zero bit of a bitset. */
+inline ColorId first_zero_bit(
+        const uint64_t* bitset,
+        VertexPos number_of_words)
+{
+    for (VertexPos word_pos = 0; word_pos < number_of_words; ++word_pos)
+        if (~bitset[word_pos] != 0)
+            return word_pos * 64 + lowest_bit(~bitset[word_pos]);
+    return number_of_words * 64;
+}
+
+}
+
+template <typename Graph>
+Coloring optimizationtools::greedy_coloring(
+        const Graph& graph,
+        const std::vector<VertexId>& ordering)
+{
+    VertexId number_of_vertices = graph.number_of_vertices();
+    Coloring output;
+    output.colors.resize(number_of_vertices, -1);
+
+    // Colors used by the neighbors of the current vertex.
+    std::vector<uint64_t> forbidden_colors(graph.highest_degree() / 64 + 1, 0);
+    for (VertexId vertex_id: ordering) {
+        ColorId highest_color = graph.degree(vertex_id);
+        graph.for_each_neighbor(
+                vertex_id,
+                [&output, &forbidden_colors, highest_color](VertexId neighbor_id)
+                {
+                    ColorId color = output.colors[neighbor_id];
+                    if (color != -1 && color <= highest_color)
+                        forbidden_colors[color / 64] |= (uint64_t)1 << (color % 64);
+                });
+        VertexPos number_of_words = highest_color / 64 + 1;
+        ColorId color = first_zero_bit(forbidden_colors.data(), number_of_words);
+        std::fill(forbidden_colors.begin(), forbidden_colors.begin() + number_of_words, 0);
+        output.colors[vertex_id] = color;
+        output.number_of_colors = (std::max)(output.number_of_colors, color + 1);
+    }
+    return output;
+}
+
+template Coloring optimizationtools::greedy_coloring(
+        const AbstractGraph&,
+        const std::vector<VertexId>&);
+template Coloring optimizationtools::greedy_coloring(
+        const AdjacencyListGraph&,
+        const std::vector<VertexId>&);
+template Coloring optimizationtools::greedy_coloring(
+        const AdjacencyMatrixGraph&,
+        const std::vector<VertexId>&);
+template Coloring optimizationtools::greedy_coloring(
+        const CliqueGraph&,
+        const std::vector<VertexId>&);
+template Coloring optimizationtools::greedy_coloring(
+        const ComplementGraphView&,
+        const std::vector<VertexId>&);
+template Coloring optimizationtools::greedy_coloring(
+        const CompressedGraph&,
+        const std::vector<VertexId>&);
+
+Coloring optimizationtools::greedy_coloring(
+        const AdjacencyListGraph& graph,
+        ColoringOrdering ordering)
+{
+    VertexId number_of_vertices = graph.number_of_vertices();
+    std::vector<VertexId> vertices(number_of_vertices);
+    switch (ordering) {
+    case ColoringOrdering::Natural: {
+        for (VertexId vertex_id = 0; vertex_id < number_of_vertices; ++vertex_id)
+            vertices[vertex_id] = vertex_id;
+        break;
+    } case ColoringOrdering::LargestFirst: {
+        // Counting sort by non-increasing degree.
+        std::vector<VertexId> bins(graph.highest_degree() + 2, 0);
+        for (VertexId vertex_id = 0; vertex_id < number_of_vertices; ++vertex_id)
+            bins[graph.highest_degree() - graph.degree(vertex_id) + 1]++;
+        for (VertexPos pos = 1; pos < (VertexPos)bins.size(); ++pos)
+            bins[pos] += bins[pos - 1];
+        for (VertexId vertex_id = 0; vertex_id < number_of_vertices; ++vertex_id)
+            vertices[bins[graph.highest_degree() - graph.degree(vertex_id)]++] = vertex_id;
+        break;
+    } case ColoringOrdering::SmallestLast: {
+        CoreDecomposition core_decomposition = optimizationtools::core_decomposition(graph);
+        vertices.assign(
+                core_decomposition.ordering.rbegin(),
+                core_decomposition.ordering.rend());
+        break;
+    }
+    }
+    return greedy_coloring(graph, vertices);
+}
+
+Coloring optimizationtools::greedy_coloring(
+        const AdjacencyListGraph& graph,
+        std::mt19937_64& generator)
+{
+    IndexedSet vertices(graph.number_of_vertices());
+    vertices.fill();
+    vertices.shuffle(generator);
+    return greedy_coloring(
+            graph,
+            std::vector<VertexId>(vertices.begin(), vertices.end()));
+}
+
+template <typename Graph>
+Coloring optimizationtools::dsatur_coloring(const Graph& graph)
+{
+    VertexId number_of_vertices = graph.number_of_vertices();
+    Coloring output;
+
+    // The data of a vertex accessed when one of its neighbors is colored are
+    // stored together, and kept small, so that updating a neighbor usually
+    // touches a single cache line.
+    struct DsaturVertex
+    {
+        /**
+         * Number of different colors among the neighbors; '-1' once the
+         * vertex is colored.
+         */
+        VertexPos saturation;
+
+        /** Position of the degree of the vertex among the distinct degrees. */
+        VertexPos degree_class;
+
+        /** Bitset of the colors smaller than 64 of the neighbors. */
+        uint64_t neighbor_colors;
+    };
+    std::vector<DsaturVertex> vertices(number_of_vertices);
+
+    // The colors of the neighbors from 64 up to the degree of the vertices
+    // are stored in a single array; 'neighbor_colors_offsets[v]' is the
+    // position of the bitset of vertex 'v'.
+    std::vector<EdgeId> neighbor_colors_offsets(number_of_vertices + 1, 0);
+    for (VertexId vertex_id = 0; vertex_id < number_of_vertices; ++vertex_id) {
+        neighbor_colors_offsets[vertex_id + 1] = neighbor_colors_offsets[vertex_id]
+            + graph.degree(vertex_id) / 64;
+    }
+    std::vector<uint64_t> neighbor_colors(neighbor_colors_offsets.back(), 0);
+
+    // Number the distinct degrees by increasing value.
+    std::vector<VertexPos> degree_classes(graph.highest_degree() + 1, -1);
+    for (VertexId vertex_id = 0; vertex_id < number_of_vertices; ++vertex_id)
+        degree_classes[graph.degree(vertex_id)] = 0;
+    VertexPos number_of_degree_classes = 0;
+    for (VertexPos degree = 0; degree <= graph.highest_degree(); ++degree)
+        if (degree_classes[degree] == 0)
+            degree_classes[degree] = number_of_degree_classes++;
+    for (VertexId vertex_id = 0; vertex_id < number_of_vertices; ++vertex_id) {
+        DsaturVertex& vertex = vertices[vertex_id];
+        vertex.saturation = 0;
+        vertex.degree_class = degree_classes[graph.degree(vertex_id)];
+        vertex.neighbor_colors = 0;
+    }
+
+    // The uncolored vertices are stored in buckets keyed by
+    // 'saturation * number_of_degree_classes + degree_class', so that the
+    // vertex to color is in the non-empty bucket with the highest key. When
+    // the saturation of a vertex increases, it is pushed in its new bucket
+    // and its entry in its previous bucket becomes stale; stale entries are
+    // skipped when they are popped. The buckets of a saturation level are
+    // only allocated once a vertex reaches it.
+    std::vector<std::vector<VertexId>> buckets(number_of_degree_classes);
+    for (VertexId vertex_id = number_of_vertices - 1; vertex_id >= 0; --vertex_id)
+        buckets[vertices[vertex_id].degree_class].push_back(vertex_id);
+    EdgeId highest_key = number_of_degree_classes - 1;
+
+    output.colors.resize(number_of_vertices, -1);
+    for (;;) {
+        while (highest_key >= 0 && buckets[highest_key].empty())
+            highest_key--;
+        if (highest_key < 0)
+            break;
+        VertexId vertex_id = buckets[highest_key].back();
+        buckets[highest_key].pop_back();
+        DsaturVertex& vertex = vertices[vertex_id];
+        if (vertex.saturation * number_of_degree_classes + vertex.degree_class
+                != highest_key) {
+            continue;
+        }
+
+        // One of the colors up to the degree is free.
+        ColorId color = (~vertex.neighbor_colors != 0)?
+            lowest_bit(~vertex.neighbor_colors):
+            64 + first_zero_bit(
+                    neighbor_colors.data() + neighbor_colors_offsets[vertex_id],
+                    neighbor_colors_offsets[vertex_id + 1] - neighbor_colors_offsets[vertex_id]);
+        vertex.saturation = -1;
+        output.colors[vertex_id] = color;
+        output.number_of_colors = (std::max)(output.number_of_colors, color + 1);
+
+        // Update the saturations of the uncolored neighbors.
+        graph.for_each_neighbor(
+                vertex_id,
+                [&graph, &output, &vertices, &neighbor_colors_offsets, &neighbor_colors,
+                &buckets, &highest_key, number_of_degree_classes, vertex_id, color](
+                    VertexId neighbor_id)
+                {
+                    DsaturVertex& neighbor = vertices[neighbor_id];
+                    if (neighbor.saturation == -1)
+                        return;
+                    if (color < 64
+                            || color / 64 <= neighbor_colors_offsets[neighbor_id + 1]
+                            - neighbor_colors_offsets[neighbor_id]) {
+                        uint64_t& word = (color < 64)?
+                            neighbor.neighbor_colors:
+                            neighbor_colors[neighbor_colors_offsets[neighbor_id] + color / 64 - 1];
+                        uint64_t bit = (uint64_t)1 << (color % 64);
+                        if (word & bit)
+                            return;
+                        word |= bit;
+                    } else {
+                        // The color is not in the bitset; check if another
+                        // neighbor already has it.
+                        bool found = false;
+                        graph.for_each_neighbor(
+                                neighbor_id,
+                                [&output, &found, vertex_id, color](VertexId neighbor_2_id)
+                                {
+                                    if (neighbor_2_id != vertex_id
+                                            && output.colors[neighbor_2_id] == color) {
+                                        found = true;
+                                    }
+                                });
+                        if (found)
+                            return;
+                    }
+                    neighbor.saturation++;
+                    EdgeId key = neighbor.saturation * number_of_degree_classes
+                        + neighbor.degree_class;
+                    if ((EdgeId)buckets.size() <= key)
+                        buckets.resize((neighbor.saturation + 1) * number_of_degree_classes);
+                    buckets[key].push_back(neighbor_id);
+                    highest_key = (std::max)(highest_key, key);
+                });
+    }
+    return output;
+}
+
+template Coloring optimizationtools::dsatur_coloring(
+        const AbstractGraph&);
+template Coloring optimizationtools::dsatur_coloring(
+        const AdjacencyListGraph&);
+template Coloring optimizationtools::dsatur_coloring(
+        const AdjacencyMatrixGraph&);
+template Coloring optimizationtools::dsatur_coloring(
+        const CliqueGraph&);
+template Coloring optimizationtools::dsatur_coloring(
+        const ComplementGraphView&);
+template Coloring optimizationtools::dsatur_coloring(
+        const CompressedGraph&);
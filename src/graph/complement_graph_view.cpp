@@ -0,0 +1,36 @@
+#include "optimizationtools/graph/complement_graph_view.hpp"
+
+#include <algorithm>
+
+using namespace optimizationtools;
+
+ComplementGraphView::ComplementGraphView(
+        const AdjacencyListGraph& graph):
+    graph_(&graph),
+    adjacency_offsets_(graph.number_of_vertices() + 1, 0)
+{
+    adjacency_.reserve(2 * graph.number_of_edges());
+    EdgeId number_of_original_edges = 0;
+    VertexPos lowest_original_degree = graph.number_of_vertices();
+    for (VertexId vertex_id = 0;
+            vertex_id < graph.number_of_vertices();
+            ++vertex_id) {
+        adjacency_.insert(
+                adjacency_.end(),
+                graph.neighbors_begin(vertex_id),
+                graph.neighbors_end(vertex_id));
+        auto begin = adjacency_.begin() + adjacency_offsets_[vertex_id];
+        std::sort(begin, adjacency_.end());
+        adjacency_.erase(std::unique(begin, adjacency_.end()), adjacency_.end());
+        adjacency_offsets_[vertex_id + 1] = adjacency_.size();
+
+        VertexPos original_degree = adjacency_offsets_[vertex_id + 1] - adjacency_offsets_[vertex_id];
+        number_of_original_edges += original_degree;
+        lowest_original_degree = (std::min)(lowest_original_degree, original_degree);
+    }
+    number_of_original_edges /= 2;
+
+    VertexId n = graph.number_of_vertices();
+    number_of_edges_ = n * (n - 1) / 2 - number_of_original_edges;
+    highest_degree_ = (n == 0)? 0: n - 1 - lowest_original_degree;
+}
@@ -0,0 +1,83 @@
+#include "optimizationtools/graph/compressed_graph.hpp"
+
+#include <algorithm>
+
+using namespace optimizationtools;
+
+CompressedGraph::CompressedGraph(const AbstractGraph& graph)
+{
+    CompressedGraphBuilder graph_builder;
+    std::vector<VertexId> neighbors;
+    for (VertexId vertex_id = 0;
+            vertex_id < graph.number_of_vertices();
+            ++vertex_id) {
+        graph_builder.add_vertex(
+                graph.neighbors(vertex_id, neighbors),
+                graph.weight(vertex_id));
+    }
+    *this = graph_builder.build();
+}
+
+bool CompressedGraph::has_edge(
+        VertexId vertex_id_1,
+        VertexId vertex_id_2) const
+{
+    if (degree(vertex_id_1) > degree(vertex_id_2))
+        std::swap(vertex_id_1, vertex_id_2);
+    // The neighbors are sorted, so the decoding stops at the first neighbor
+    // which is not smaller than 'vertex_id_2'.
+    for (VertexId neighbor_id: neighbors(vertex_id_1)) {
+        if (neighbor_id >= vertex_id_2)
+            return neighbor_id == vertex_id_2;
+    }
+    return false;
+}
+
+VertexId CompressedGraphBuilder::add_vertex(
+        const std::vector<VertexId>& neighbors,
+        Weight weight)
+{
+    VertexId vertex_id = graph_.number_of_vertices();
+
+    neighbors_tmp_.clear();
+    for (VertexId neighbor_id: neighbors)
+        if (neighbor_id != vertex_id)
+            neighbors_tmp_.push_back(neighbor_id);
+    std::sort(neighbors_tmp_.begin(), neighbors_tmp_.end());
+    neighbors_tmp_.erase(
+            std::unique(neighbors_tmp_.begin(), neighbors_tmp_.end()),
+            neighbors_tmp_.end());
+    if (!neighbors_tmp_.empty() && neighbors_tmp_.front() < 0) {
+        throw std::invalid_argument(
+                "Invalid neighbor: \"" + std::to_string(neighbors_tmp_.front()) + "\".");
+    }
+
+    VertexPos degree = neighbors_tmp_.size();
+    CompressedGraph::encode(degree, graph_.data_);
+    VertexId neighbor_id_prev = 0;
+    for (VertexId neighbor_id: neighbors_tmp_) {
+        CompressedGraph::encode(neighbor_id - neighbor_id_prev, graph_.data_);
+        neighbor_id_prev = neighbor_id;
+    }
+    graph_.offsets_.push_back(graph_.data_.size());
+
+    // The weights are only stored if one of them is not 1.
+    if (!graph_.weights_.empty() || weight != 1) {
+        graph_.weights_.resize(vertex_id, 1);
+        graph_.weights_.push_back(weight);
+    }
+
+    sum_of_degrees_ += degree;
+    graph_.highest_degree_ = (std::max)(graph_.highest_degree_, degree);
+    graph_.total_weight_ += weight;
+    return vertex_id;
+}
+
+CompressedGraph CompressedGraphBuilder::build()
+{
+    graph_.number_of_edges_ = sum_of_degrees_ / 2;
+    graph_.data_.shrink_to_fit();
+    graph_.offsets_.shrink_to_fit();
+    graph_.weights_.shrink_to_fit();
+    return std::move(graph_);
+}
@@ -0,0 +1,212 @@
+#include "optimizationtools/graph/connected_components.hpp"
+
+#include "optimizationtools/utils/parallel.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <random>
+#include <unordered_map>
+
+using namespace optimizationtools;
+
+namespace
+{
+
+/**
+ * Lock-free union-find in which the root of a tree is always its smallest
+ * vertex.
+ */
+class ConcurrentUnionFind
+{
+
+public:
+
+    ConcurrentUnionFind(VertexId number_of_vertices):
+        parents_(number_of_vertices)
+    {
+        for (VertexId vertex_id = 0; vertex_id < number_of_vertices; ++vertex_id)
+            parents_[vertex_id].store(vertex_id, std::memory_order_relaxed);
+    }
+
+    /** Find the root of a vertex, with path halving. */
+    inline VertexId find(VertexId vertex_id)
+    {
+        for (;;) {
+            VertexId parent_id = parents_[vertex_id].load(std::memory_order_relaxed);
+            if (parent_id == vertex_id)
+                return vertex_id;
+            VertexId grandparent_id = parents_[parent_id].load(std::memory_order_relaxed);
+            if (parent_id != grandparent_id) {
+                parents_[vertex_id].compare_exchange_weak(
+                        parent_id,
+                        grandparent_id,
+                        std::memory_order_relaxed);
+            }
+            vertex_id = grandparent_id;
+        }
+    }
+
+    /** Merge the trees of two vertices. */
+    inline void unite(
+            VertexId vertex_id_1,
+            VertexId vertex_id_2)
+    {
+        for (;;) {
+            VertexId root_1_id = find(vertex_id_1);
+            VertexId root_2_id = find(vertex_id_2);
+            if (root_1_id == root_2_id)
+                return;
+            if (root_1_id < root_2_id)
+                std::swap(root_1_id, root_2_id);
+            // Link the largest root to the smallest one. This fails if the
+            // largest root has been linked by another thread meanwhile.
+            VertexId expected_id = root_1_id;
+            if (parents_[root_1_id].compare_exchange_strong(
+                        expected_id,
+                        root_2_id,
+                        std::memory_order_relaxed)) {
+                return;
+            }
+        }
+    }
+
+    /** Make each vertex point directly to its root. */
+    inline void compress(VertexId vertex_id)
+    {
+        parents_[vertex_id].store(find(vertex_id), std::memory_order_relaxed);
+    }
+
+private:
+
+    /** Parent of each vertex. */
+    std::vector<std::atomic<VertexId>> parents_;
+
+};
+
+}
+
+std::vector<ComponentId> optimizationtools::connected_components(
+        const AdjacencyListGraph& graph,
+        int number_of_threads)
+{
+    number_of_threads = (std::max)(number_of_threads, 1);
+    VertexId number_of_vertices = graph.number_of_vertices();
+    ConcurrentUnionFind union_find(number_of_vertices);
+    const VertexPos number_of_sampled_neighbors = 2;
+    VertexId largest_root_id = -1;
+
+    // The threads are started once; each one processes the same range of
+    // vertices at each step, and the steps are separated by a barrier.
+    Barrier barrier(number_of_threads);
+    run_in_parallel(
+            number_of_threads,
+            [&graph, &union_find, &barrier, &largest_root_id,
+             number_of_vertices, number_of_threads, number_of_sampled_neighbors](
+                int thread_id)
+            {
+                VertexId vertex_start = number_of_vertices * thread_id / number_of_threads;
+                VertexId vertex_end = number_of_vertices * (thread_id + 1) / number_of_threads;
+
+                // Link each vertex to its first neighbors.
+                for (VertexPos neighbor_pos = 0;
+                        neighbor_pos < number_of_sampled_neighbors;
+                        ++neighbor_pos) {
+                    for (VertexId vertex_id = vertex_start;
+                            vertex_id < vertex_end;
+                            ++vertex_id) {
+                        const std::vector<VertexId>& neighbors = graph.vertex(vertex_id).neighbors;
+                        if (neighbor_pos < (VertexPos)neighbors.size())
+                            union_find.unite(vertex_id, neighbors[neighbor_pos]);
+                    }
+                    barrier.wait();
+                    for (VertexId vertex_id = vertex_start;
+                            vertex_id < vertex_end;
+                            ++vertex_id) {
+                        union_find.compress(vertex_id);
+                    }
+                    barrier.wait();
+                }
+
+                // Find the largest component by sampling.
+                if (thread_id == 0 && number_of_vertices > 0) {
+                    std::mt19937_64 generator(0);
+                    std::uniform_int_distribution<VertexId> distribution(0, number_of_vertices - 1);
+                    std::unordered_map<VertexId, VertexPos> roots_counts;
+                    VertexPos largest_root_count = 0;
+                    for (VertexPos sample = 0; sample < 1024; ++sample) {
+                        VertexId root_id = union_find.find(distribution(generator));
+                        VertexPos count = ++roots_counts[root_id];
+                        if (count > largest_root_count) {
+                            largest_root_id = root_id;
+                            largest_root_count = count;
+                        }
+                    }
+                }
+                barrier.wait();
+
+                // Process the remaining neighbors of the vertices which are
+                // not in the largest component. Since the graph is
+                // undirected, an edge between the largest component and
+                // another vertex is processed from the other vertex.
+                for (VertexId vertex_id = vertex_start;
+                        vertex_id < vertex_end;
+                        ++vertex_id) {
+                    if (union_find.find(vertex_id) == largest_root_id)
+                        continue;
+                    const std::vector<VertexId>& neighbors = graph.vertex(vertex_id).neighbors;
+                    for (VertexPos neighbor_pos = number_of_sampled_neighbors;
+                            neighbor_pos < (VertexPos)neighbors.size();
+                            ++neighbor_pos) {
+                        union_find.unite(vertex_id, neighbors[neighbor_pos]);
+                    }
+                }
+            });
+
+    // Number the components. Since a root is the smallest vertex of its
+    // component, a root is met before the other vertices of its component.
+    std::vector<ComponentId> components(number_of_vertices);
+    ComponentId number_of_components = 0;
+    for (VertexId vertex_id = 0; vertex_id < number_of_vertices; ++vertex_id) {
+        VertexId root_id = union_find.find(vertex_id);
+        if (root_id == vertex_id) {
+            components[vertex_id] = number_of_components;
+            number_of_components++;
+        } else {
+            components[vertex_id] = components[root_id];
+        }
+    }
+    return components;
+}
+
+std::vector<std::vector<VertexId>> optimizationtools::connected_components_vertices(
+        const AdjacencyListGraph& graph)
+{
+    if (graph.number_of_components() == -1) {
+        throw std::invalid_argument(
+                "The connected components of the graph have not been computed.");
+    }
+    std::vector<std::vector<VertexId>> components_vertices(graph.number_of_components());
+    for (VertexId vertex_id = 0;
+            vertex_id < graph.number_of_vertices();
+            ++vertex_id) {
+        components_vertices[graph.vertex(vertex_id).component].push_back(vertex_id);
+    }
+    return components_vertices;
+}
+
+AdjacencyListGraph optimizationtools::connected_component_subgraph(
+        const AdjacencyListGraph& graph,
+        const std::vector<VertexId>& component_vertices)
+{
+    // All the edges of the vertices of a connected component are kept in
+    // the subgraph.
+    AdjacencyListGraph subgraph = induced_subgraph(graph, component_vertices);
+    EdgeId number_of_ends = 0;
+    for (VertexId vertex_id: component_vertices)
+        number_of_ends += graph.degree(vertex_id);
+    if (number_of_ends != 2 * subgraph.number_of_edges()) {
+        throw std::invalid_argument(
+                "The vertices don't form a connected component.");
+    }
+    return subgraph;
+}
@@ -0,0 +1,202 @@
+#include "optimizationtools/graph/dynamic_bipartite_matching.hpp"
+
+#include "optimizationtools/graph/bipartite_graph.hpp"
+#include "optimizationtools/utils/common.hpp"
+
+using namespace optimizationtools;
+
+DynamicBipartiteMatching::DynamicBipartiteMatching(
+        const AdjacencyListGraph& graph):
+    graph_(graph),
+    vertices_sides_(bipartite_graph_identify(graph))
+{
+    if (vertices_sides_.size() != (std::size_t)graph.number_of_vertices()) {
+        throw std::invalid_argument(
+                FUNC_SIGNATURE + ": "
+                "the graph is not bipartite.");
+    }
+    initialize(graph);
+}
+
+DynamicBipartiteMatching::DynamicBipartiteMatching(
+        const AdjacencyListGraph& graph,
+        const std::vector<uint8_t>& vertices_sides):
+    graph_(graph),
+    vertices_sides_(vertices_sides)
+{
+    if (vertices_sides_.size() != (std::size_t)graph.number_of_vertices()) {
+        throw std::invalid_argument(
+                FUNC_SIGNATURE + ": "
+                "wrong number of sides; "
+                "vertices_sides.size(): " + std::to_string(vertices_sides.size()) + "; "
+                "graph.number_of_vertices(): " + std::to_string(graph.number_of_vertices()) + ".");
+    }
+    initialize(graph);
+}
+
+DynamicBipartiteMatching::DynamicBipartiteMatching(
+        const std::vector<uint8_t>& vertices_sides):
+    graph_(vertices_sides.size()),
+    vertices_sides_(vertices_sides),
+    vertices_matched_edge_(vertices_sides.size(), -1),
+    vertices_search_ids_(vertices_sides.size(), 0),
+    vertices_pred_edge_(vertices_sides.size(), -1)
+{
+    for (uint8_t side: vertices_sides_)
+        sides_number_of_vertices_[side]++;
+}
+
+void DynamicBipartiteMatching::initialize(const AdjacencyListGraph& graph)
+{
+    for (EdgeId edge_id = 0; edge_id < graph.number_of_edges(); ++edge_id) {
+        const AdjacencyListGraph::Edge& edge = graph.edge(edge_id);
+        if (vertices_sides_[edge.vertex_1_id] == vertices_sides_[edge.vertex_2_id]) {
+            throw std::invalid_argument(
+                    FUNC_SIGNATURE + ": "
+                    "both ends of edge " + std::to_string(edge_id)
+                    + " are on side " + std::to_string(vertices_sides_[edge.vertex_1_id]) + ".");
+        }
+    }
+
+    for (uint8_t side: vertices_sides_)
+        sides_number_of_vertices_[side]++;
+    vertices_matched_edge_.resize(graph.number_of_vertices(), -1);
+    vertices_search_ids_.resize(graph.number_of_vertices(), 0);
+    vertices_pred_edge_.resize(graph.number_of_vertices(), -1);
+
+    BipartiteGraph bipartite_graph(graph, vertices_sides_);
+    const std::vector<uint8_t>& edges_matched = bipartite_graph.maximum_matching();
+    for (EdgeId edge_id = 0; edge_id < graph.number_of_edges(); ++edge_id)
+        if (edges_matched[edge_id] == 1)
+            match(edge_id);
+}
+
+std::vector<uint8_t> DynamicBipartiteMatching::maximum_matching() const
+{
+    std::vector<uint8_t> edges_matched(graph_.number_of_edge_ids(), 0);
+    for (VertexId vertex_id = 0;
+            vertex_id < graph_.number_of_vertices();
+            ++vertex_id) {
+        if (vertices_matched_edge_[vertex_id] != -1)
+            edges_matched[vertices_matched_edge_[vertex_id]] = 1;
+    }
+    return edges_matched;
+}
+
+bool DynamicBipartiteMatching::augment(
+        VertexId root_id,
+        VertexId blocked_vertex_id)
+{
+    // The search ends at a free vertex of the other side of the root.
+    uint8_t end_side = 1 - vertices_sides_[root_id];
+    VertexId number_of_end_vertices = sides_number_of_vertices_[end_side] - matching_size_;
+    if (blocked_vertex_id != -1
+            && vertices_sides_[blocked_vertex_id] == end_side
+            && vertices_matched_edge_[blocked_vertex_id] == -1) {
+        number_of_end_vertices--;
+    }
+    if (number_of_end_vertices == 0)
+        return false;
+
+    search_id_++;
+    vertices_search_ids_[root_id] = search_id_;
+    if (blocked_vertex_id != -1)
+        vertices_search_ids_[blocked_vertex_id] = search_id_;
+    queue_.clear();
+    queue_.push_back(root_id);
+
+    // The queue only contains vertices of the side of the root; the vertices
+    // of the other side are reached through an unmatched edge and left
+    // through their matched edge.
+    for (VertexPos queue_pos = 0;
+            queue_pos < (VertexPos)queue_.size();
+            ++queue_pos) {
+        VertexId vertex_id = queue_[queue_pos];
+        number_of_visited_vertices_++;
+        for (const DynamicGraph::VertexEdge& vertex_edge: graph_.edges(vertex_id)) {
+            if (vertex_edge.edge_id == vertices_matched_edge_[vertex_id])
+                continue;
+            VertexId neighbor_id = vertex_edge.vertex_id;
+            if (vertices_search_ids_[neighbor_id] == search_id_)
+                continue;
+            vertices_search_ids_[neighbor_id] = search_id_;
+            number_of_visited_vertices_++;
+
+            EdgeId neighbor_matched_edge_id = vertices_matched_edge_[neighbor_id];
+            if (neighbor_matched_edge_id == -1) {
+                // Flip the path from the root to the free neighbor.
+                EdgeId edge_id = vertex_edge.edge_id;
+                VertexId vertex_2_id = neighbor_id;
+                for (;;) {
+                    EdgeId previous_matched_edge_id = vertices_matched_edge_[vertex_id];
+                    vertices_matched_edge_[vertex_id] = edge_id;
+                    vertices_matched_edge_[vertex_2_id] = edge_id;
+                    if (vertex_id == root_id)
+                        break;
+                    vertex_2_id = graph_.other_end(previous_matched_edge_id, vertex_id);
+                    edge_id = vertices_pred_edge_[vertex_id];
+                    vertex_id = graph_.other_end(edge_id, vertex_2_id);
+                }
+                matching_size_++;
+                return true;
+            }
+
+            VertexId mate_id = graph_.other_end(neighbor_matched_edge_id, neighbor_id);
+            if (vertices_search_ids_[mate_id] == search_id_)
+                continue;
+            vertices_search_ids_[mate_id] = search_id_;
+            vertices_pred_edge_[mate_id] = vertex_edge.edge_id;
+            queue_.push_back(mate_id);
+        }
+    }
+    return false;
+}
+
+EdgeId DynamicBipartiteMatching::add_edge(
+        VertexId vertex_id_1,
+        VertexId vertex_id_2)
+{
+    if (vertices_sides_[vertex_id_1] == vertices_sides_[vertex_id_2]) {
+        throw std::invalid_argument(
+                FUNC_SIGNATURE + ": "
+                "vertices " + std::to_string(vertex_id_1)
+                + " and " + std::to_string(vertex_id_2)
+                + " are on the same side.");
+    }
+    EdgeId edge_id = graph_.add_edge(vertex_id_1, vertex_id_2);
+
+    EdgeId matched_edge_1_id = vertices_matched_edge_[vertex_id_1];
+    EdgeId matched_edge_2_id = vertices_matched_edge_[vertex_id_2];
+    if (matched_edge_1_id == -1 && matched_edge_2_id == -1) {
+        match(edge_id);
+    } else if (matched_edge_1_id == -1) {
+        augment(vertex_id_1);
+    } else if (matched_edge_2_id == -1) {
+        augment(vertex_id_2);
+    } else {
+        // Free 'vertex_id_1' by flipping an alternating path from it through
+        // its matched edge to a free vertex, without going through it again.
+        VertexId mate_id = graph_.other_end(matched_edge_1_id, vertex_id_1);
+        unmatch(matched_edge_1_id);
+        if (augment(mate_id, vertex_id_1)) {
+            augment(vertex_id_1);
+        } else {
+            match(matched_edge_1_id);
+        }
+    }
+    return edge_id;
+}
+
+void DynamicBipartiteMatching::remove_edge(EdgeId edge_id)
+{
+    if (!graph_.contains_edge(edge_id))
+        return;
+    bool matched = is_matched(edge_id);
+    VertexId vertex_id_1 = graph_.edge(edge_id).vertex_1_id;
+    VertexId vertex_id_2 = graph_.edge(edge_id).vertex_2_id;
+    if (matched)
+        unmatch(edge_id);
+    graph_.remove_edge(edge_id);
+    if (matched && !augment(vertex_id_1))
+        augment(vertex_id_2);
+}
@@ -0,0 +1,104 @@
+#include "optimizationtools/graph/dynamic_graph.hpp"
+
+#include <algorithm>
+
+using namespace optimizationtools;
+
+DynamicGraph::DynamicGraph(VertexId number_of_vertices):
+    vertices_(number_of_vertices),
+    active_vertices_(number_of_vertices),
+    total_weight_(number_of_vertices)
+{
+    active_vertices_.fill();
+}
+
+DynamicGraph::DynamicGraph(const AdjacencyListGraph& graph):
+    vertices_(graph.number_of_vertices()),
+    edges_(graph.number_of_edges()),
+    active_vertices_(graph.number_of_vertices()),
+    number_of_edges_(graph.number_of_edges()),
+    total_weight_(graph.total_weight())
+{
+    active_vertices_.fill();
+    for (VertexId vertex_id = 0;
+            vertex_id < graph.number_of_vertices();
+            ++vertex_id) {
+        vertices_[vertex_id].weight = graph.weight(vertex_id);
+        vertices_[vertex_id].edges.reserve(graph.degree(vertex_id));
+    }
+    for (EdgeId edge_id = 0; edge_id < graph.number_of_edges(); ++edge_id) {
+        Edge& edge = edges_[edge_id];
+        edge.vertex_1_id = graph.first_end(edge_id);
+        edge.vertex_2_id = graph.second_end(edge_id);
+        edge.vertex_1_position = vertices_[edge.vertex_1_id].edges.size();
+        vertices_[edge.vertex_1_id].edges.push_back({edge_id, edge.vertex_2_id});
+        edge.vertex_2_position = vertices_[edge.vertex_2_id].edges.size();
+        vertices_[edge.vertex_2_id].edges.push_back({edge_id, edge.vertex_1_id});
+    }
+}
+
+EdgeId DynamicGraph::find_edge(
+        VertexId vertex_id_1,
+        VertexId vertex_id_2) const
+{
+    if (degree(vertex_id_1) > degree(vertex_id_2))
+        std::swap(vertex_id_1, vertex_id_2);
+    for (const VertexEdge& vertex_edge: vertices_[vertex_id_1].edges)
+        if (vertex_edge.vertex_id == vertex_id_2)
+            return vertex_edge.edge_id;
+    return -1;
+}
+
+EdgeId DynamicGraph::add_edge(
+        VertexId vertex_id_1,
+        VertexId vertex_id_2)
+{
+    if (!contains(vertex_id_1) || !contains(vertex_id_2)) {
+        throw std::invalid_argument(
+                "Cannot add an edge to a removed vertex.");
+    }
+    if (vertex_id_1 == vertex_id_2)
+        return -1;
+
+    EdgeId edge_id = edges_.size();
+    Edge edge;
+    edge.vertex_1_id = vertex_id_1;
+    edge.vertex_2_id = vertex_id_2;
+    edge.vertex_1_position = vertices_[vertex_id_1].edges.size();
+    edge.vertex_2_position = vertices_[vertex_id_2].edges.size();
+    edges_.push_back(edge);
+    vertices_[vertex_id_1].edges.push_back({edge_id, vertex_id_2});
+    vertices_[vertex_id_2].edges.push_back({edge_id, vertex_id_1});
+    number_of_edges_++;
+    return edge_id;
+}
+
+void DynamicGraph::remove_vertex(VertexId vertex_id)
+{
+    if (!contains(vertex_id))
+        return;
+    while (!vertices_[vertex_id].edges.empty())
+        remove_edge(vertices_[vertex_id].edges.back().edge_id);
+    active_vertices_.remove(vertex_id);
+    total_weight_ -= vertices_[vertex_id].weight;
+}
+
+AdjacencyListGraph DynamicGraph::compact(
+        std::vector<VertexId>& original_vertex_ids) const
+{
+    original_vertex_ids.assign(active_vertices_.begin(), active_vertices_.end());
+    std::sort(original_vertex_ids.begin(), original_vertex_ids.end());
+    std::vector<VertexId> new_vertex_ids(number_of_vertices(), -1);
+    AdjacencyListGraphBuilder graph_builder;
+    for (VertexId vertex_id: original_vertex_ids) {
+        new_vertex_ids[vertex_id] = graph_builder.add_vertex(weight(vertex_id));
+    }
+    for (const Edge& edge: edges_) {
+        if (edge.vertex_1_id == -1)
+            continue;
+        graph_builder.add_edge(
+                new_vertex_ids[edge.vertex_1_id],
+                new_vertex_ids[edge.vertex_2_id]);
+    }
+    return graph_builder.build();
+}
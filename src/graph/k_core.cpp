@@ -0,0 +1,228 @@
+#include "optimizationtools/graph/k_core.hpp"
+
+#include "optimizationtools/utils/parallel.hpp"
+
+#include <algorithm>
+#include <atomic>
+
+using namespace optimizationtools;
+
+namespace
+{
+
+/**
+ * Compute the k-core decomposition with the bucket algorithm of Batagelj and
+ * Zaversnik.
+ */
+CoreDecomposition core_decomposition_sequential(
+        const AdjacencyListGraph& graph)
+{
+    VertexId number_of_vertices = graph.number_of_vertices();
+    CoreDecomposition output;
+
+    // Sort the vertices by degree with a counting sort. 'bins[d]' is the
+    // position of the first vertex of degree 'd'.
+    std::vector<VertexPos>& degrees = output.core_numbers;
+    degrees.resize(number_of_vertices);
+    std::vector<VertexPos> bins(graph.highest_degree() + 2, 0);
+    for (VertexId vertex_id = 0; vertex_id < number_of_vertices; ++vertex_id) {
+        degrees[vertex_id] = graph.degree(vertex_id);
+        bins[degrees[vertex_id] + 1]++;
+    }
+    for (VertexPos degree = 1; degree < (VertexPos)bins.size(); ++degree)
+        bins[degree] += bins[degree - 1];
+    std::vector<VertexId>& order = output.ordering;
+    order.resize(number_of_vertices);
+    std::vector<VertexPos> positions(number_of_vertices);
+    {
+        std::vector<VertexPos> bins_tmp(bins);
+        for (VertexId vertex_id = 0; vertex_id < number_of_vertices; ++vertex_id) {
+            positions[vertex_id] = bins_tmp[degrees[vertex_id]]++;
+            order[positions[vertex_id]] = vertex_id;
+        }
+    }
+
+    // When a vertex is removed, its current degree is its core number.
+    for (VertexPos position = 0; position < number_of_vertices; ++position) {
+        VertexId vertex_id = order[position];
+        output.degeneracy = (std::max)(output.degeneracy, degrees[vertex_id]);
+        graph.for_each_neighbor(
+                vertex_id,
+                [&degrees, &bins, &order, &positions, vertex_id](VertexId neighbor_id)
+                {
+                    if (degrees[neighbor_id] <= degrees[vertex_id])
+                        return;
+                    // Move the neighbor at the start of its bin and decrease
+                    // its degree.
+                    VertexPos degree = degrees[neighbor_id];
+                    VertexPos neighbor_position = positions[neighbor_id];
+                    VertexPos first_position = bins[degree];
+                    VertexId first_vertex_id = order[first_position];
+                    if (first_vertex_id != neighbor_id) {
+                        order[neighbor_position] = first_vertex_id;
+                        positions[first_vertex_id] = neighbor_position;
+                        order[first_position] = neighbor_id;
+                        positions[neighbor_id] = first_position;
+                    }
+                    bins[degree]++;
+                    degrees[neighbor_id]--;
+                });
+    }
+    return output;
+}
+
+/**
+ * Compute the k-core decomposition by peeling the vertices level by level,
+ * in parallel.
+ */
+CoreDecomposition core_decomposition_parallel(
+        const AdjacencyListGraph& graph,
+        int number_of_threads)
+{
+    VertexId number_of_vertices = graph.number_of_vertices();
+    CoreDecomposition output;
+    output.core_numbers.resize(number_of_vertices, -1);
+    output.ordering.reserve(number_of_vertices);
+
+    std::vector<std::atomic<VertexPos>> degrees(number_of_vertices);
+    for (VertexId vertex_id = 0; vertex_id < number_of_vertices; ++vertex_id)
+        degrees[vertex_id].store(graph.degree(vertex_id), std::memory_order_relaxed);
+
+    // Each thread keeps the remaining vertices of its range of vertices in
+    // a list, which is compacted when it is scanned at the start of a level,
+    // so that the removed vertices are not scanned again.
+    std::vector<std::vector<VertexId>> threads_remaining_vertices(number_of_threads);
+    std::vector<std::vector<VertexId>> threads_buffers(number_of_threads);
+    std::vector<VertexPos> threads_minimum_degrees(number_of_threads);
+    std::vector<VertexId> round_vertices;
+    VertexPos next_level = 0;
+
+    // The threads are started once. Between two steps, they wait at the
+    // barrier while thread 0 gathers the vertices of the next round.
+    Barrier barrier(number_of_threads);
+    auto gather_round_vertices = [&output, &threads_buffers, &round_vertices](
+            VertexPos level)
+    {
+        round_vertices.clear();
+        for (const std::vector<VertexId>& buffer: threads_buffers)
+            round_vertices.insert(round_vertices.end(), buffer.begin(), buffer.end());
+        std::sort(round_vertices.begin(), round_vertices.end());
+        for (VertexId vertex_id: round_vertices) {
+            output.core_numbers[vertex_id] = level;
+            output.ordering.push_back(vertex_id);
+        }
+    };
+    run_in_parallel(
+            number_of_threads,
+            [&graph, &output, &degrees, &threads_remaining_vertices, &threads_buffers,
+            &threads_minimum_degrees, &round_vertices, &next_level, &barrier,
+            &gather_round_vertices, number_of_vertices, number_of_threads](int thread_id)
+            {
+                std::vector<VertexId>& remaining_vertices = threads_remaining_vertices[thread_id];
+                std::vector<VertexId>& buffer = threads_buffers[thread_id];
+                VertexPos& minimum_degree = threads_minimum_degrees[thread_id];
+                VertexId vertex_id_start = number_of_vertices * thread_id / number_of_threads;
+                VertexId vertex_id_end = number_of_vertices * (thread_id + 1) / number_of_threads;
+                for (VertexId vertex_id = vertex_id_start;
+                        vertex_id < vertex_id_end;
+                        ++vertex_id) {
+                    remaining_vertices.push_back(vertex_id);
+                }
+
+                while ((VertexId)output.ordering.size() < number_of_vertices) {
+                    VertexPos level = next_level;
+
+                    // Find the remaining vertices of degree at most 'level',
+                    // and the smallest degree of the others.
+                    buffer.clear();
+                    minimum_degree = -1;
+                    VertexId number_of_remaining_vertices = 0;
+                    for (VertexId vertex_id: remaining_vertices) {
+                        if (output.core_numbers[vertex_id] != -1)
+                            continue;
+                        VertexPos degree = degrees[vertex_id].load(std::memory_order_relaxed);
+                        if (degree <= level) {
+                            buffer.push_back(vertex_id);
+                            continue;
+                        }
+                        remaining_vertices[number_of_remaining_vertices++] = vertex_id;
+                        if (minimum_degree == -1 || minimum_degree > degree)
+                            minimum_degree = degree;
+                    }
+                    remaining_vertices.resize(number_of_remaining_vertices);
+                    barrier.wait();
+                    if (thread_id == 0) {
+                        gather_round_vertices(level);
+                        // If no vertex is removed at this level, the degrees
+                        // don't change, so the next level is the smallest
+                        // remaining degree.
+                        next_level = level + 1;
+                        if (!round_vertices.empty()) {
+                            output.degeneracy = level;
+                        } else {
+                            VertexPos minimum_degree = -1;
+                            for (VertexPos degree: threads_minimum_degrees)
+                                if (degree != -1 && (minimum_degree == -1 || minimum_degree > degree))
+                                    minimum_degree = degree;
+                            next_level = (std::max)(next_level, minimum_degree);
+                        }
+                    }
+                    barrier.wait();
+
+                    // Remove the vertices round by round.
+                    while (!round_vertices.empty()) {
+                        buffer.clear();
+                        VertexId number_of_round_vertices = round_vertices.size();
+                        VertexId pos_start = number_of_round_vertices * thread_id / number_of_threads;
+                        VertexId pos_end = number_of_round_vertices * (thread_id + 1) / number_of_threads;
+                        for (VertexId pos = pos_start; pos < pos_end; ++pos) {
+                            graph.for_each_neighbor(
+                                    round_vertices[pos],
+                                    [&output, &degrees, &buffer, level](VertexId neighbor_id)
+                                    {
+                                        if (output.core_numbers[neighbor_id] != -1)
+                                            return;
+                                        // Only the decrement from 'level + 1'
+                                        // to 'level' adds the neighbor to the
+                                        // next round, so it is added once.
+                                        VertexPos degree = degrees[neighbor_id].fetch_sub(
+                                                1,
+                                                std::memory_order_relaxed);
+                                        if (degree == level + 1)
+                                            buffer.push_back(neighbor_id);
+                                    });
+                        }
+                        barrier.wait();
+                        if (thread_id == 0)
+                            gather_round_vertices(level);
+                        barrier.wait();
+                    }
+                }
+            });
+    return output;
+}
+
+}
+
+CoreDecomposition optimizationtools::core_decomposition(
+        const AdjacencyListGraph& graph,
+        int number_of_threads)
+{
+    if (number_of_threads <= 1)
+        return core_decomposition_sequential(graph);
+    return core_decomposition_parallel(graph, number_of_threads);
+}
+
+std::vector<VertexId> optimizationtools::k_core_vertices(
+        const CoreDecomposition& core_decomposition,
+        VertexPos k)
+{
+    std::vector<VertexId> vertices;
+    for (VertexId vertex_id = 0;
+            vertex_id < (VertexId)core_decomposition.core_numbers.size();
+            ++vertex_id) {
+        if (core_decomposition.core_numbers[vertex_id] >= k)
+            vertices.push_back(vertex_id);
+    }
+    return vertices;
+}
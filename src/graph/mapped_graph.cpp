@@ -0,0 +1,411 @@
+#include "optimizationtools/graph/mapped_graph.hpp"
+
+#include "optimizationtools/graph/graph_reader.hpp"
+
+#include "optimizationtools/utils/common.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <cstring>
+#include <cstdio>
+#include <queue>
+#include <functional>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace optimizationtools;
+
+namespace
+{
+
+/** Header of the files of the MappedGraph. */
+const char mapped_graph_header[8] = {'O', 'T', 'C', 'S', 'R', '0', '0', '1'};
+
+/** Number of arcs read or written at once. */
+const EdgeId block_size = 1 << 16;
+
+typedef std::pair<VertexId, VertexId> Arc;
+
+/**
+ * Merge sorted runs, calling 'function(arc)' for each arc in order.
+ *
+ * If 'remove_duplicate_arcs' is 'true', each arc is only passed once.
+ */
+template <typename Function>
+void merge_runs(
+        const std::vector<std::string>& runs_paths,
+        bool remove_duplicate_arcs,
+        const Function& function)
+{
+    struct Run
+    {
+        std::ifstream file;
+        std::vector<Arc> arcs;
+        EdgeId position = 0;
+    };
+    std::vector<Run> runs(runs_paths.size());
+    auto read_block = [](Run& run)
+    {
+        run.arcs.resize(block_size);
+        run.file.read(
+                reinterpret_cast<char*>(run.arcs.data()),
+                block_size * sizeof(Arc));
+        run.arcs.resize(run.file.gcount() / sizeof(Arc));
+        run.position = 0;
+    };
+    // Min-heap of the current arc of each run.
+    typedef std::pair<Arc, int> HeapElement;
+    std::priority_queue<
+        HeapElement,
+        std::vector<HeapElement>,
+        std::greater<HeapElement>> heap;
+    for (int run_id = 0; run_id < (int)runs.size(); ++run_id) {
+        Run& run = runs[run_id];
+        run.file.open(runs_paths[run_id], std::ios::in | std::ios::binary);
+        if (!run.file.good()) {
+            throw std::runtime_error(
+                    "Unable to open file \"" + runs_paths[run_id] + "\".");
+        }
+        read_block(run);
+        if (!run.arcs.empty())
+            heap.push({run.arcs[0], run_id});
+    }
+
+    Arc arc_prev(-1, -1);
+    while (!heap.empty()) {
+        Arc arc = heap.top().first;
+        int run_id = heap.top().second;
+        heap.pop();
+        Run& run = runs[run_id];
+        run.position++;
+        if (run.position == (EdgeId)run.arcs.size())
+            read_block(run);
+        if (run.position < (EdgeId)run.arcs.size())
+            heap.push({run.arcs[run.position], run_id});
+
+        if (remove_duplicate_arcs && arc == arc_prev)
+            continue;
+        arc_prev = arc;
+        function(arc);
+    }
+}
+
+}
+
+MappedGraph::MappedGraph(const std::string& path):
+    path_(path)
+{
+#if defined(__unix__) || defined(__APPLE__)
+    int file_descriptor = open(path.c_str(), O_RDONLY);
+    if (file_descriptor == -1) {
+        throw std::runtime_error(
+                "Unable to open file \"" + path + "\".");
+    }
+    struct stat file_status;
+    if (fstat(file_descriptor, &file_status) == 0 && file_status.st_size > 0) {
+        size_ = file_status.st_size;
+        void* mapping = mmap(nullptr, size_, PROT_READ, MAP_SHARED, file_descriptor, 0);
+        if (mapping != MAP_FAILED) {
+            mapping_.data = mapping;
+            mapping_.size = size_;
+        }
+    }
+    close(file_descriptor);
+#endif
+
+    if (mapping_.data == nullptr) {
+        std::ifstream file(path, std::ios::in | std::ios::binary | std::ios::ate);
+        if (!file.good()) {
+            throw std::runtime_error(
+                    "Unable to open file \"" + path + "\".");
+        }
+        size_ = file.tellg();
+        content_.resize(size_);
+        file.seekg(0);
+        file.read(content_.data(), size_);
+    }
+    const char* data = (mapping_.data != nullptr)?
+        static_cast<const char*>(mapping_.data):
+        content_.data();
+
+    if (size_ < 3 * sizeof(int64_t)
+            || std::memcmp(data, mapped_graph_header, sizeof(mapped_graph_header)) != 0) {
+        throw std::runtime_error(
+                "Invalid header in file \"" + path + "\".");
+    }
+    const int64_t* values = reinterpret_cast<const int64_t*>(data);
+    number_of_vertices_ = values[1];
+    number_of_arcs_ = values[2];
+    // Check the numbers of vertices and arcs against the size of the file
+    // before computing the expected size, which could overflow.
+    int64_t number_of_values = size_ / sizeof(int64_t) - 3;
+    if (size_ % sizeof(int64_t) != 0
+            || number_of_vertices_ < 0
+            || number_of_arcs_ < 0
+            || number_of_vertices_ > (number_of_values - 1) / 2
+            || number_of_arcs_ != number_of_values - 2 * number_of_vertices_ - 1) {
+        throw std::runtime_error(
+                "Invalid size for file \"" + path + "\".");
+    }
+    weights_ = reinterpret_cast<const Weight*>(values + 3);
+    offsets_ = values + 3 + number_of_vertices_;
+    neighbors_ = values + 3 + 2 * number_of_vertices_ + 1;
+
+    if (offsets_[0] != 0 || offsets_[number_of_vertices_] != number_of_arcs_) {
+        throw std::runtime_error(
+                "Invalid offsets in file \"" + path + "\".");
+    }
+    for (VertexId vertex_id = 0;
+            vertex_id < number_of_vertices_;
+            ++vertex_id) {
+        if (degree(vertex_id) < 0) {
+            throw std::runtime_error(
+                    "Invalid offsets in file \"" + path + "\".");
+        }
+        highest_degree_ = (std::max)(highest_degree_, degree(vertex_id));
+        total_weight_ += weight(vertex_id);
+    }
+    // The neighbors are scanned sequentially, so that a corrupt file is
+    // rejected here rather than leading to out-of-bounds accesses later.
+    for (EdgeId arc_id = 0; arc_id < number_of_arcs_; ++arc_id) {
+        if (neighbors_[arc_id] < 0 || neighbors_[arc_id] >= number_of_vertices_) {
+            throw std::runtime_error(
+                    "Invalid neighbors in file \"" + path + "\".");
+        }
+    }
+}
+
+MappedGraph::MappedGraph(MappedGraph&& graph):
+    path_(std::move(graph.path_)),
+    mapping_(std::move(graph.mapping_)),
+    size_(graph.size_),
+    content_(std::move(graph.content_)),
+    number_of_vertices_(graph.number_of_vertices_),
+    number_of_arcs_(graph.number_of_arcs_),
+    weights_(graph.weights_),
+    offsets_(graph.offsets_),
+    neighbors_(graph.neighbors_),
+    highest_degree_(graph.highest_degree_),
+    total_weight_(graph.total_weight_)
+{
+}
+
+MappedGraph::~MappedGraph()
+{
+}
+
+MappedGraph::FileMapping::~FileMapping()
+{
+#if defined(__unix__) || defined(__APPLE__)
+    if (data != nullptr)
+        munmap(data, size);
+#endif
+}
+
+ExternalMemoryGraphBuilder::ExternalMemoryGraphBuilder(
+        const std::string& temporary_path_prefix,
+        EdgeId buffer_size,
+        EdgeId maximum_number_of_merged_runs):
+    temporary_path_prefix_(temporary_path_prefix),
+    buffer_size_((std::max)(buffer_size, (EdgeId)2)),
+    maximum_number_of_merged_runs_((std::max)(maximum_number_of_merged_runs, (EdgeId)2))
+{
+}
+
+ExternalMemoryGraphBuilder::~ExternalMemoryGraphBuilder()
+{
+    for (const std::string& run_path: runs_paths_)
+        std::remove(run_path.c_str());
+}
+
+void ExternalMemoryGraphBuilder::read(
+        const std::string& instance_path,
+        const std::string& format)
+{
+    read_graph(instance_path, format, *this);
+}
+
+void ExternalMemoryGraphBuilder::reserve(
+        VertexId number_of_vertices,
+        EdgeId)
+{
+    weights_.reserve(number_of_vertices);
+}
+
+VertexId ExternalMemoryGraphBuilder::add_vertex(Weight weight)
+{
+    weights_.push_back(weight);
+    return weights_.size() - 1;
+}
+
+void ExternalMemoryGraphBuilder::set_weight(
+        VertexId vertex_id,
+        Weight weight)
+{
+    weights_[vertex_id] = weight;
+}
+
+EdgeId ExternalMemoryGraphBuilder::add_edge(
+        VertexId vertex_1_id,
+        VertexId vertex_2_id)
+{
+    if (vertex_1_id < 0 || vertex_1_id >= (VertexId)weights_.size()
+            || vertex_2_id < 0 || vertex_2_id >= (VertexId)weights_.size()) {
+        throw std::invalid_argument(
+                FUNC_SIGNATURE + ": "
+                "invalid end; "
+                "vertex_1_id: " + std::to_string(vertex_1_id) + "; "
+                "vertex_2_id: " + std::to_string(vertex_2_id) + "; "
+                "number_of_vertices: " + std::to_string(weights_.size()) + ".");
+    }
+    if (vertex_1_id == vertex_2_id)
+        return -1;
+    if ((EdgeId)buffer_.size() + 2 > buffer_size_)
+        write_run();
+    buffer_.push_back({vertex_1_id, vertex_2_id});
+    buffer_.push_back({vertex_2_id, vertex_1_id});
+    number_of_edges_++;
+    return number_of_edges_ - 1;
+}
+
+std::string ExternalMemoryGraphBuilder::new_run_path()
+{
+    std::string run_path = temporary_path_prefix_ + "run_" + std::to_string(number_of_runs_);
+    number_of_runs_++;
+    return run_path;
+}
+
+void ExternalMemoryGraphBuilder::write_run()
+{
+    if (buffer_.empty())
+        return;
+    std::sort(buffer_.begin(), buffer_.end());
+    std::string run_path = new_run_path();
+    std::ofstream file(run_path, std::ios::out | std::ios::binary);
+    if (!file.good()) {
+        throw std::runtime_error(
+                "Unable to open file \"" + run_path + "\".");
+    }
+    runs_paths_.push_back(run_path);
+    static_assert(
+            sizeof(Arc) == 2 * sizeof(VertexId),
+            "An arc must only contain its two ends.");
+    file.write(
+            reinterpret_cast<const char*>(buffer_.data()),
+            buffer_.size() * sizeof(Arc));
+    if (!file.good()) {
+        throw std::runtime_error(
+                "Unable to write file \"" + run_path + "\".");
+    }
+    buffer_.clear();
+}
+
+MappedGraph ExternalMemoryGraphBuilder::build(
+        const std::string& path,
+        bool remove_duplicate_edges)
+{
+    write_run();
+    std::vector<Arc>().swap(buffer_);
+
+    // Merge the runs by groups until they can all be merged at once.
+    while ((EdgeId)runs_paths_.size() > maximum_number_of_merged_runs_) {
+        std::vector<std::string> runs_paths;
+        runs_paths.swap(runs_paths_);
+        for (std::size_t run_pos = 0;
+                run_pos < runs_paths.size();
+                run_pos += maximum_number_of_merged_runs_) {
+            std::vector<std::string> merged_runs_paths(
+                    runs_paths.begin() + run_pos,
+                    runs_paths.begin() + (std::min)(
+                        run_pos + maximum_number_of_merged_runs_,
+                        runs_paths.size()));
+            std::string run_path = new_run_path();
+            std::ofstream file(run_path, std::ios::out | std::ios::binary);
+            if (!file.good()) {
+                throw std::runtime_error(
+                        "Unable to open file \"" + run_path + "\".");
+            }
+            runs_paths_.push_back(run_path);
+            std::vector<Arc> arcs;
+            arcs.reserve(block_size);
+            merge_runs(
+                    merged_runs_paths,
+                    remove_duplicate_edges,
+                    [&file, &arcs](const Arc& arc)
+                    {
+                        arcs.push_back(arc);
+                        if ((EdgeId)arcs.size() == block_size) {
+                            file.write(reinterpret_cast<const char*>(arcs.data()), arcs.size() * sizeof(Arc));
+                            arcs.clear();
+                        }
+                    });
+            file.write(reinterpret_cast<const char*>(arcs.data()), arcs.size() * sizeof(Arc));
+            file.close();
+            if (!file.good()) {
+                throw std::runtime_error(
+                        "Unable to write file \"" + run_path + "\".");
+            }
+            for (const std::string& merged_run_path: merged_runs_paths)
+                std::remove(merged_run_path.c_str());
+        }
+    }
+
+    // Write the header and the weights. The offsets, which are only known
+    // once all the arcs have been merged, are written at the end.
+    std::ofstream file(path, std::ios::out | std::ios::binary);
+    if (!file.good()) {
+        throw std::runtime_error(
+                "Unable to open file \"" + path + "\".");
+    }
+    int64_t number_of_vertices = weights_.size();
+    int64_t number_of_arcs = 0;
+    file.write(mapped_graph_header, sizeof(mapped_graph_header));
+    file.write(reinterpret_cast<const char*>(&number_of_vertices), sizeof(number_of_vertices));
+    file.write(reinterpret_cast<const char*>(&number_of_arcs), sizeof(number_of_arcs));
+    file.write(reinterpret_cast<const char*>(weights_.data()), number_of_vertices * sizeof(Weight));
+    std::streamoff offsets_position = file.tellp();
+    file.seekp(offsets_position + (number_of_vertices + 1) * sizeof(EdgeId));
+
+    // Merge the remaining runs.
+    std::vector<EdgeId> offsets(number_of_vertices + 1, 0);
+    std::vector<VertexId> neighbors;
+    neighbors.reserve(block_size);
+    merge_runs(
+            runs_paths_,
+            remove_duplicate_edges,
+            [&file, &offsets, &neighbors, &number_of_arcs](const Arc& arc)
+            {
+                offsets[arc.first + 1]++;
+                neighbors.push_back(arc.second);
+                number_of_arcs++;
+                if ((EdgeId)neighbors.size() == block_size) {
+                    file.write(reinterpret_cast<const char*>(neighbors.data()), neighbors.size() * sizeof(VertexId));
+                    neighbors.clear();
+                }
+            });
+    file.write(reinterpret_cast<const char*>(neighbors.data()), neighbors.size() * sizeof(VertexId));
+
+    // Write the offsets and the number of arcs.
+    for (VertexId vertex_id = 0; vertex_id < number_of_vertices; ++vertex_id)
+        offsets[vertex_id + 1] += offsets[vertex_id];
+    file.seekp(offsets_position);
+    file.write(reinterpret_cast<const char*>(offsets.data()), offsets.size() * sizeof(EdgeId));
+    file.seekp(sizeof(mapped_graph_header) + sizeof(number_of_vertices));
+    file.write(reinterpret_cast<const char*>(&number_of_arcs), sizeof(number_of_arcs));
+    file.close();
+    if (!file.good()) {
+        throw std::runtime_error(
+                "Unable to write file \"" + path + "\".");
+    }
+
+    for (const std::string& run_path: runs_paths_)
+        std::remove(run_path.c_str());
+    runs_paths_.clear();
+
+    return MappedGraph(path);
+}
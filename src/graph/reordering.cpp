@@ -0,0 +1,347 @@
+#include "optimizationtools/graph/reordering.hpp"
+
+#include "optimizationtools/graph/k_core.hpp"
+
+#include "optimizationtools/containers/indexed_4ary_heap.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <cmath>
+#include <limits>
+
+using namespace optimizationtools;
+
+namespace
+{
+
+/**
+ * Run a breadth first search from a vertex and return the eccentricity of the
+ * vertex in its connected component.
+ *
+ * The vertices of the last level are written in 'last_level'.
+ *
+ * 'distances' must be '-1' for all the vertices of the component. It is
+ * restored before returning, so that a search only costs the size of the
+ * component.
+ */
+VertexPos eccentricity(
+        const AdjacencyListGraph& graph,
+        VertexId source_id,
+        std::vector<VertexPos>& distances,
+        std::vector<VertexId>& queue,
+        std::vector<VertexId>& last_level)
+{
+    queue.clear();
+    queue.push_back(source_id);
+    distances[source_id] = 0;
+    for (VertexPos queue_position = 0;
+            queue_position < (VertexPos)queue.size();
+            ++queue_position) {
+        VertexId vertex_id = queue[queue_position];
+        VertexPos distance = distances[vertex_id] + 1;
+        graph.for_each_neighbor(
+                vertex_id,
+                [&distances, &queue, distance](VertexId neighbor_id)
+                {
+                    if (distances[neighbor_id] != -1)
+                        return;
+                    distances[neighbor_id] = distance;
+                    queue.push_back(neighbor_id);
+                });
+    }
+
+    VertexPos eccentricity = distances[queue.back()];
+    last_level.clear();
+    for (VertexId vertex_id: queue) {
+        if (distances[vertex_id] == eccentricity)
+            last_level.push_back(vertex_id);
+        distances[vertex_id] = -1;
+    }
+    return eccentricity;
+}
+
+/**
+ * Find a pseudo-peripheral vertex of the connected component of a vertex
+ * with the algorithm of George and Liu.
+ */
+VertexId pseudo_peripheral_vertex(
+        const AdjacencyListGraph& graph,
+        VertexId vertex_id,
+        std::vector<VertexPos>& distances,
+        std::vector<VertexId>& queue,
+        std::vector<VertexId>& last_level)
+{
+    VertexPos vertex_eccentricity = eccentricity(
+            graph,
+            vertex_id,
+            distances,
+            queue,
+            last_level);
+    for (;;) {
+        // Select the vertex of the last level with the smallest degree.
+        VertexId vertex_next_id = last_level[0];
+        for (VertexId vertex_id_2: last_level)
+            if (graph.degree(vertex_id_2) < graph.degree(vertex_next_id))
+                vertex_next_id = vertex_id_2;
+        VertexPos vertex_next_eccentricity = eccentricity(
+                graph,
+                vertex_next_id,
+                distances,
+                queue,
+                last_level);
+        if (vertex_next_eccentricity <= vertex_eccentricity)
+            return vertex_id;
+        vertex_id = vertex_next_id;
+        vertex_eccentricity = vertex_next_eccentricity;
+    }
+}
+
+std::vector<VertexId> reverse_cuthill_mckee(
+        const AdjacencyListGraph& graph)
+{
+    VertexId number_of_vertices = graph.number_of_vertices();
+
+    // The search of each connected component starts from its vertex of
+    // minimum degree.
+    std::vector<VertexId> sorted_vertices(number_of_vertices);
+    std::iota(sorted_vertices.begin(), sorted_vertices.end(), 0);
+    std::stable_sort(
+            sorted_vertices.begin(),
+            sorted_vertices.end(),
+            [&graph](VertexId vertex_id_1, VertexId vertex_id_2) -> bool
+            {
+                return graph.degree(vertex_id_1) < graph.degree(vertex_id_2);
+            });
+
+    std::vector<VertexId> order;
+    order.reserve(number_of_vertices);
+    std::vector<uint8_t> vertices_visited(number_of_vertices, 0);
+    std::vector<VertexPos> distances(number_of_vertices, -1);
+    std::vector<VertexId> queue;
+    std::vector<VertexId> last_level;
+    std::vector<VertexId> neighbors;
+    for (VertexId vertex_0_id: sorted_vertices) {
+        if (vertices_visited[vertex_0_id])
+            continue;
+        VertexId source_id = pseudo_peripheral_vertex(
+                graph,
+                vertex_0_id,
+                distances,
+                queue,
+                last_level);
+
+        vertices_visited[source_id] = 1;
+        order.push_back(source_id);
+        for (VertexPos order_position = order.size() - 1;
+                order_position < (VertexPos)order.size();
+                ++order_position) {
+            // Append the unvisited neighbors by non-decreasing degree.
+            neighbors.clear();
+            graph.for_each_neighbor(
+                    order[order_position],
+                    [&vertices_visited, &neighbors](VertexId neighbor_id)
+                    {
+                        if (vertices_visited[neighbor_id])
+                            return;
+                        vertices_visited[neighbor_id] = 1;
+                        neighbors.push_back(neighbor_id);
+                    });
+            std::sort(
+                    neighbors.begin(),
+                    neighbors.end(),
+                    [&graph](VertexId vertex_id_1, VertexId vertex_id_2) -> bool
+                    {
+                        if (graph.degree(vertex_id_1) != graph.degree(vertex_id_2))
+                            return graph.degree(vertex_id_1) < graph.degree(vertex_id_2);
+                        return vertex_id_1 < vertex_id_2;
+                    });
+            order.insert(order.end(), neighbors.begin(), neighbors.end());
+        }
+    }
+
+    std::reverse(order.begin(), order.end());
+    return order;
+}
+
+std::vector<VertexId> degree_descending(
+        const AdjacencyListGraph& graph)
+{
+    std::vector<VertexId> order(graph.number_of_vertices());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(
+            order.begin(),
+            order.end(),
+            [&graph](VertexId vertex_id_1, VertexId vertex_id_2) -> bool
+            {
+                return graph.degree(vertex_id_1) > graph.degree(vertex_id_2);
+            });
+    return order;
+}
+
+/**
+ * Gorder-style heuristic.
+ *
+ * The score of a vertex is the number of edges plus the number of common
+ * neighbors between the vertex and the last 'window_size' vertices of the
+ * order. The vertex with the highest score is appended to the order. The
+ * common neighbors through vertices of degree larger than sqrt(n) are
+ * ignored, otherwise, the scores of too many vertices would have to be
+ * updated.
+ */
+std::vector<VertexId> gorder(
+        const AdjacencyListGraph& graph,
+        VertexPos window_size)
+{
+    VertexId number_of_vertices = graph.number_of_vertices();
+    std::vector<VertexId> order;
+    if (number_of_vertices == 0)
+        return order;
+    order.reserve(number_of_vertices);
+    VertexPos hub_degree = std::sqrt((double)number_of_vertices);
+
+    // The heap is a min-heap, therefore, the keys are the opposite of the
+    // scores.
+    std::vector<Counter> scores(number_of_vertices, 0);
+    Indexed4aryHeap<Counter> heap(
+            number_of_vertices,
+            [](VertexId) { return 0; });
+    auto update_scores = [&graph, &scores, &heap, hub_degree](
+            VertexId vertex_id,
+            Counter delta)
+    {
+        auto update_score = [&scores, &heap, delta](VertexId vertex_id_2)
+        {
+            if (!heap.contains(vertex_id_2))
+                return;
+            scores[vertex_id_2] += delta;
+            heap.update_key(vertex_id_2, -scores[vertex_id_2]);
+        };
+        graph.for_each_neighbor(
+                vertex_id,
+                [&graph, &update_score, hub_degree](VertexId neighbor_id)
+                {
+                    update_score(neighbor_id);
+                    if (graph.degree(neighbor_id) > hub_degree)
+                        return;
+                    graph.for_each_neighbor(neighbor_id, update_score);
+                });
+    };
+
+    // Start with a vertex of maximum degree.
+    VertexId vertex_id = 0;
+    for (VertexId vertex_id_2 = 0; vertex_id_2 < number_of_vertices; ++vertex_id_2)
+        if (graph.degree(vertex_id_2) > graph.degree(vertex_id))
+            vertex_id = vertex_id_2;
+    heap.update_key(vertex_id, std::numeric_limits<Counter>::lowest());
+    heap.pop();
+
+    for (;;) {
+        order.push_back(vertex_id);
+        update_scores(vertex_id, 1);
+        if ((VertexPos)order.size() > window_size)
+            update_scores(order[order.size() - 1 - window_size], -1);
+        if (heap.empty())
+            break;
+        vertex_id = heap.top().first;
+        heap.pop();
+    }
+    return order;
+}
+
+}
+
+VertexReordering optimizationtools::vertex_reordering(
+        const std::vector<VertexId>& original_vertex_ids)
+{
+    VertexReordering reordering;
+    reordering.original_vertex_ids = original_vertex_ids;
+    reordering.new_vertex_ids.resize(original_vertex_ids.size(), -1);
+    for (VertexId vertex_id = 0;
+            vertex_id < (VertexId)original_vertex_ids.size();
+            ++vertex_id) {
+        VertexId original_vertex_id = original_vertex_ids[vertex_id];
+        if (original_vertex_id < 0
+                || original_vertex_id >= (VertexId)original_vertex_ids.size()
+                || reordering.new_vertex_ids[original_vertex_id] != -1) {
+            throw std::invalid_argument(
+                    "The vertex ids don't form a permutation.");
+        }
+        reordering.new_vertex_ids[original_vertex_id] = vertex_id;
+    }
+    return reordering;
+}
+
+VertexReordering optimizationtools::compute_vertex_reordering(
+        const AdjacencyListGraph& graph,
+        VertexOrdering ordering,
+        VertexPos window_size)
+{
+    switch (ordering) {
+    case VertexOrdering::ReverseCuthillMcKee:
+        return vertex_reordering(reverse_cuthill_mckee(graph));
+    case VertexOrdering::DegreeDescending:
+        return vertex_reordering(degree_descending(graph));
+    case VertexOrdering::Degeneracy:
+        return vertex_reordering(core_decomposition(graph).ordering);
+    case VertexOrdering::Gorder:
+        return vertex_reordering(gorder(graph, window_size));
+    }
+    throw std::invalid_argument(
+            "Unknown vertex ordering.");
+}
+
+AdjacencyListGraph optimizationtools::reorder(
+        const AdjacencyListGraph& graph,
+        const VertexReordering& reordering)
+{
+    if ((VertexId)reordering.original_vertex_ids.size() != graph.number_of_vertices()) {
+        throw std::invalid_argument(
+                "The size of the reordering doesn't match the number of vertices.");
+    }
+
+    AdjacencyListGraphBuilder graph_builder;
+    for (VertexId original_vertex_id: reordering.original_vertex_ids)
+        graph_builder.add_vertex(graph.weight(original_vertex_id));
+
+    // The edges are added by increasing first end and then increasing second
+    // end, so that the neighbors of each vertex are sorted.
+    std::vector<VertexId> neighbors;
+    for (VertexId vertex_id = 0;
+            vertex_id < graph.number_of_vertices();
+            ++vertex_id) {
+        neighbors.clear();
+        graph.for_each_neighbor(
+                reordering.original_vertex_ids[vertex_id],
+                [&reordering, &neighbors, vertex_id](VertexId neighbor_id)
+                {
+                    VertexId new_neighbor_id = reordering.new_vertex_ids[neighbor_id];
+                    if (new_neighbor_id > vertex_id)
+                        neighbors.push_back(new_neighbor_id);
+                });
+        std::sort(neighbors.begin(), neighbors.end());
+        for (VertexId neighbor_id: neighbors)
+            graph_builder.add_edge(vertex_id, neighbor_id);
+    }
+    return graph_builder.build();
+}
+
+std::vector<VertexId> optimizationtools::to_original_vertex_ids(
+        const VertexReordering& reordering,
+        const std::vector<VertexId>& vertex_ids)
+{
+    std::vector<VertexId> original_vertex_ids(vertex_ids.size());
+    for (VertexPos pos = 0; pos < (VertexPos)vertex_ids.size(); ++pos)
+        original_vertex_ids[pos] = reordering.original_vertex_ids[vertex_ids[pos]];
+    return original_vertex_ids;
+}
+
+std::vector<std::vector<VertexId>> optimizationtools::to_original_vertex_ids(
+        const VertexReordering& reordering,
+        const std::vector<std::vector<VertexId>>& vertex_ids)
+{
+    std::vector<std::vector<VertexId>> original_vertex_ids;
+    original_vertex_ids.reserve(vertex_ids.size());
+    for (const std::vector<VertexId>& vertex_ids_cur: vertex_ids)
+        original_vertex_ids.push_back(to_original_vertex_ids(reordering, vertex_ids_cur));
+    return original_vertex_ids;
+}
@@ -0,0 +1,73 @@
+#include "optimizationtools/graph/subgraph_view.hpp"
+
+#include <algorithm>
+
+using namespace optimizationtools;
+
+SubgraphView::SubgraphView(const AdjacencyListGraph& graph):
+    graph_(&graph),
+    vertices_(graph.number_of_vertices()),
+    degrees_(graph.number_of_vertices()),
+    number_of_edges_(graph.number_of_edges()),
+    total_weight_(graph.total_weight())
+{
+    vertices_.fill();
+    for (VertexId vertex_id = 0;
+            vertex_id < graph.number_of_vertices();
+            ++vertex_id) {
+        degrees_[vertex_id] = graph.degree(vertex_id);
+    }
+}
+
+SubgraphView::SubgraphView(
+        const AdjacencyListGraph& graph,
+        const std::vector<VertexId>& vertex_ids):
+    graph_(&graph),
+    vertices_(graph.number_of_vertices()),
+    degrees_(graph.number_of_vertices(), 0)
+{
+    for (VertexId vertex_id: vertex_ids) {
+        if (vertices_.add(vertex_id))
+            total_weight_ += graph.weight(vertex_id);
+    }
+    for (VertexId vertex_id: vertices_) {
+        for_each_neighbor(
+                vertex_id,
+                [this, vertex_id](VertexId) { degrees_[vertex_id]++; });
+        number_of_edges_ += degrees_[vertex_id];
+    }
+    number_of_edges_ /= 2;
+}
+
+void SubgraphView::materialize()
+{
+    // The materialized neighbors are computed with the current neighbors, so
+    // they are stored only at the end.
+    std::vector<EdgeId> neighbors_offsets(graph_->number_of_vertices() + 1, 0);
+    for (VertexId vertex_id: vertices_)
+        neighbors_offsets[vertex_id + 1] = degrees_[vertex_id];
+    for (VertexId vertex_id = 0;
+            vertex_id < graph_->number_of_vertices();
+            ++vertex_id) {
+        neighbors_offsets[vertex_id + 1] += neighbors_offsets[vertex_id];
+    }
+    std::vector<VertexId> neighbors(neighbors_offsets.back());
+    for (VertexId vertex_id: vertices_) {
+        EdgeId pos = neighbors_offsets[vertex_id];
+        for_each_neighbor(
+                vertex_id,
+                [&neighbors, &pos](VertexId neighbor_id) { neighbors[pos++] = neighbor_id; });
+    }
+    neighbors_offsets_ = std::move(neighbors_offsets);
+    neighbors_ = std::move(neighbors);
+}
+
+AdjacencyListGraph SubgraphView::build_graph(
+        std::vector<VertexId>& original_vertex_ids) const
+{
+    original_vertex_ids.assign(vertices_.begin(), vertices_.end());
+    std::sort(original_vertex_ids.begin(), original_vertex_ids.end());
+
+    // The neighbors which are not active are skipped by 'induced_subgraph'.
+    return induced_subgraph(*graph_, original_vertex_ids);
+}
@@ -0,0 +1,240 @@
+#include "optimizationtools/graph/triangles.hpp"
+
+#include "optimizationtools/utils/parallel.hpp"
+
+#include <algorithm>
+#include <atomic>
+
+using namespace optimizationtools;
+
+namespace
+{
+
+inline void add(
+        std::vector<Counter>& counters,
+        std::size_t pos,
+        Counter value)
+{
+    counters[pos] += value;
+}
+
+inline void add(
+        std::vector<std::atomic<Counter>>& counters,
+        std::size_t pos,
+        Counter value)
+{
+    counters[pos].fetch_add(value, std::memory_order_relaxed);
+}
+
+/**
+ * Graph whose edges are oriented from their end of lower rank to their end
+ * of higher rank, the vertices being numbered by rank.
+ */
+struct OrientedGraph
+{
+    /** For each rank, the vertex of this rank. */
+    std::vector<VertexId> vertices;
+
+    /**
+     * For each vertex, the position of its first out-neighbor, followed by
+     * the total number of out-neighbors before the removal of the parallel
+     * edges.
+     */
+    std::vector<EdgeId> offsets;
+
+    /** For each vertex, its number of out-neighbors. */
+    std::vector<VertexPos> out_degrees;
+
+    /** Out-neighbors, with the id of the corresponding edge. */
+    std::vector<std::pair<VertexId, EdgeId>> out_neighbors;
+};
+
+OrientedGraph build_oriented_graph(
+        const AdjacencyListGraph& graph,
+        int number_of_threads)
+{
+    VertexId number_of_vertices = graph.number_of_vertices();
+    OrientedGraph oriented_graph;
+
+    // Rank the vertices by degree, then by id, with a counting sort.
+    std::vector<VertexId> bins(graph.highest_degree() + 2, 0);
+    for (VertexId vertex_id = 0; vertex_id < number_of_vertices; ++vertex_id)
+        bins[graph.degree(vertex_id) + 1]++;
+    for (VertexPos degree = 1; degree < (VertexPos)bins.size(); ++degree)
+        bins[degree] += bins[degree - 1];
+    oriented_graph.vertices.resize(number_of_vertices);
+    std::vector<VertexId> ranks(number_of_vertices);
+    for (VertexId vertex_id = 0; vertex_id < number_of_vertices; ++vertex_id) {
+        ranks[vertex_id] = bins[graph.degree(vertex_id)]++;
+        oriented_graph.vertices[ranks[vertex_id]] = vertex_id;
+    }
+
+    oriented_graph.offsets.resize(number_of_vertices + 1, 0);
+    for (VertexId rank = 0; rank < number_of_vertices; ++rank) {
+        VertexPos number_of_out_neighbors = 0;
+        graph.for_each_neighbor(
+                oriented_graph.vertices[rank],
+                [&ranks, &number_of_out_neighbors, rank](VertexId neighbor_id)
+                {
+                    if (ranks[neighbor_id] > rank)
+                        number_of_out_neighbors++;
+                });
+        oriented_graph.offsets[rank + 1] = oriented_graph.offsets[rank] + number_of_out_neighbors;
+    }
+
+    // Fill and sort the out-neighbors of each vertex; the vertices own
+    // disjoint ranges, so they are processed in parallel.
+    oriented_graph.out_neighbors.resize(oriented_graph.offsets[number_of_vertices]);
+    oriented_graph.out_degrees.resize(number_of_vertices);
+    run_in_parallel(
+            number_of_threads,
+            [&graph, &ranks, &oriented_graph,
+            number_of_vertices, number_of_threads](int thread_id)
+            {
+                VertexId rank_start = number_of_vertices * thread_id / number_of_threads;
+                VertexId rank_end = number_of_vertices * (thread_id + 1) / number_of_threads;
+                for (VertexId rank = rank_start; rank < rank_end; ++rank) {
+                    auto begin = oriented_graph.out_neighbors.begin() + oriented_graph.offsets[rank];
+                    auto end = begin;
+                    for (const AdjacencyListGraph::VertexEdge& vertex_edge:
+                            graph.vertex(oriented_graph.vertices[rank]).edges) {
+                        if (ranks[vertex_edge.vertex_id] > rank) {
+                            *end = {ranks[vertex_edge.vertex_id], vertex_edge.edge_id};
+                            ++end;
+                        }
+                    }
+                    // Parallel edges: keep the one with the smallest id.
+                    std::sort(begin, end);
+                    end = std::unique(
+                            begin,
+                            end,
+                            [](
+                                const std::pair<VertexId, EdgeId>& out_neighbor_1,
+                                const std::pair<VertexId, EdgeId>& out_neighbor_2)
+                            {
+                                return out_neighbor_1.first == out_neighbor_2.first;
+                            });
+                    oriented_graph.out_degrees[rank] = end - begin;
+                }
+            });
+
+    return oriented_graph;
+}
+
+/**
+ * Count the triangles whose vertex of lowest rank is in the ranks handed out
+ * by 'next_rank'.
+ *
+ * 'Counters' is 'std::vector<Counter>' if a single thread increments the
+ * counters, 'std::vector<std::atomic<Counter>>' otherwise.
+ */
+template <typename Counters>
+Counter count_triangles_ranks(
+        const OrientedGraph& oriented_graph,
+        std::atomic<VertexId>& next_rank,
+        Counters& vertices_number_of_triangles,
+        Counters& edges_number_of_triangles)
+{
+    VertexId number_of_vertices = oriented_graph.vertices.size();
+    const VertexId chunk_size = 64;
+    // For each vertex, the id of the edge from the current vertex to it if
+    // it is an out-neighbor of the current vertex, '-1' otherwise.
+    std::vector<EdgeId> marks(number_of_vertices, -1);
+    Counter number_of_triangles = 0;
+    for (;;) {
+        VertexId rank_start = next_rank.fetch_add(chunk_size);
+        if (rank_start >= number_of_vertices)
+            break;
+        VertexId rank_end = (std::min)(rank_start + chunk_size, number_of_vertices);
+        for (VertexId rank = rank_start; rank < rank_end; ++rank) {
+            const std::pair<VertexId, EdgeId>* out_neighbors
+                = oriented_graph.out_neighbors.data() + oriented_graph.offsets[rank];
+            VertexPos out_degree = oriented_graph.out_degrees[rank];
+            if (out_degree < 2)
+                continue;
+            for (VertexPos pos = 0; pos < out_degree; ++pos)
+                marks[out_neighbors[pos].first] = out_neighbors[pos].second;
+
+            Counter vertex_number_of_triangles = 0;
+            for (VertexPos pos = 0; pos < out_degree; ++pos) {
+                VertexId rank_2 = out_neighbors[pos].first;
+                const std::pair<VertexId, EdgeId>* out_neighbors_2
+                    = oriented_graph.out_neighbors.data() + oriented_graph.offsets[rank_2];
+                VertexPos out_degree_2 = oriented_graph.out_degrees[rank_2];
+                Counter edge_number_of_triangles = 0;
+                for (VertexPos pos_2 = 0; pos_2 < out_degree_2; ++pos_2) {
+                    VertexId rank_3 = out_neighbors_2[pos_2].first;
+                    EdgeId edge_1_3_id = marks[rank_3];
+                    if (edge_1_3_id == -1)
+                        continue;
+                    edge_number_of_triangles++;
+                    add(edges_number_of_triangles, edge_1_3_id, 1);
+                    add(edges_number_of_triangles, out_neighbors_2[pos_2].second, 1);
+                    add(vertices_number_of_triangles, oriented_graph.vertices[rank_3], 1);
+                }
+                if (edge_number_of_triangles > 0) {
+                    add(edges_number_of_triangles, out_neighbors[pos].second, edge_number_of_triangles);
+                    add(vertices_number_of_triangles, oriented_graph.vertices[rank_2], edge_number_of_triangles);
+                    vertex_number_of_triangles += edge_number_of_triangles;
+                }
+            }
+            add(vertices_number_of_triangles, oriented_graph.vertices[rank], vertex_number_of_triangles);
+            number_of_triangles += vertex_number_of_triangles;
+
+            for (VertexPos pos = 0; pos < out_degree; ++pos)
+                marks[out_neighbors[pos].first] = -1;
+        }
+    }
+    return number_of_triangles;
+}
+
+}
+
+TriangleCounts optimizationtools::count_triangles(
+        const AdjacencyListGraph& graph,
+        int number_of_threads)
+{
+    number_of_threads = (std::max)(number_of_threads, 1);
+    VertexId number_of_vertices = graph.number_of_vertices();
+    EdgeId number_of_edges = graph.number_of_edges();
+    TriangleCounts output;
+    OrientedGraph oriented_graph = build_oriented_graph(graph, number_of_threads);
+
+    std::atomic<VertexId> next_rank(0);
+    if (number_of_threads == 1) {
+        output.vertices_number_of_triangles.resize(number_of_vertices, 0);
+        output.edges_number_of_triangles.resize(number_of_edges, 0);
+        output.number_of_triangles = count_triangles_ranks(
+                oriented_graph,
+                next_rank,
+                output.vertices_number_of_triangles,
+                output.edges_number_of_triangles);
+        return output;
+    }
+
+    std::vector<std::atomic<Counter>> vertices_number_of_triangles(number_of_vertices);
+    std::vector<std::atomic<Counter>> edges_number_of_triangles(number_of_edges);
+    std::vector<Counter> threads_number_of_triangles(number_of_threads, 0);
+    run_in_parallel(
+            number_of_threads,
+            [&oriented_graph, &next_rank,
+            &vertices_number_of_triangles, &edges_number_of_triangles,
+            &threads_number_of_triangles](int thread_id)
+            {
+                threads_number_of_triangles[thread_id] = count_triangles_ranks(
+                        oriented_graph,
+                        next_rank,
+                        vertices_number_of_triangles,
+                        edges_number_of_triangles);
+            });
+
+    for (int thread_id = 0; thread_id < number_of_threads; ++thread_id)
+        output.number_of_triangles += threads_number_of_triangles[thread_id];
+    output.vertices_number_of_triangles.resize(number_of_vertices);
+    for (VertexId vertex_id = 0; vertex_id < number_of_vertices; ++vertex_id)
+        output.vertices_number_of_triangles[vertex_id] = vertices_number_of_triangles[vertex_id].load();
+    output.edges_number_of_triangles.resize(number_of_edges);
+    for (EdgeId edge_id = 0; edge_id < number_of_edges; ++edge_id)
+        output.edges_number_of_triangles[edge_id] = edges_number_of_triangles[edge_id].load();
+    return output;
+}
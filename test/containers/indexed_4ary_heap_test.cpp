@@ -0,0 +1,170 @@
+#include "optimizationtools/containers/indexed_4ary_heap.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+using namespace optimizationtools;
+
+namespace
+{
+
+/**
+ * Reference 4-ary heap, moving the elements by swaps, with the same rules to
+ * break ties as Indexed4aryHeap: an element only moves past strictly larger
+ * (resp. smaller) keys, and among equal children, the first one is chosen.
+ */
+class Reference4aryHeap
+{
+
+public:
+
+    typedef int64_t Index;
+    typedef int64_t Position;
+
+    Reference4aryHeap(Index number_of_elements): positions_(number_of_elements, -1) { }
+
+    const std::vector<std::pair<Index, int64_t>>& heap() const { return heap_; }
+
+    void pop()
+    {
+        positions_[heap_[0].first] = -1;
+        if (heap_.size() == 1) {
+            heap_.pop_back();
+            return;
+        }
+        heap_[0] = heap_.back();
+        positions_[heap_[0].first] = 0;
+        heap_.pop_back();
+        percolate_down(0);
+    }
+
+    void update_key(Index index, int64_t key)
+    {
+        Position position = positions_[index];
+        if (position == -1) {
+            positions_[index] = heap_.size();
+            heap_.push_back({index, key});
+            percolate_up(heap_.size() - 1);
+        } else if (key > heap_[position].second) {
+            heap_[position].second = key;
+            percolate_down(position);
+        } else if (key < heap_[position].second) {
+            heap_[position].second = key;
+            percolate_up(position);
+        }
+    }
+
+private:
+
+    std::vector<std::pair<Index, int64_t>> heap_;
+
+    std::vector<Position> positions_;
+
+    void swap(Position position_1, Position position_2)
+    {
+        std::swap(heap_[position_1], heap_[position_2]);
+        positions_[heap_[position_1].first] = position_1;
+        positions_[heap_[position_2].first] = position_2;
+    }
+
+    void percolate_up(Position position)
+    {
+        while (position != 0
+                && heap_[position].second < heap_[(position - 1) / 4].second) {
+            swap(position, (position - 1) / 4);
+            position = (position - 1) / 4;
+        }
+    }
+
+    void percolate_down(Position position)
+    {
+        for (;;) {
+            Position position_best = position;
+            for (Position position_child = 4 * position + 1;
+                    position_child <= 4 * position + 4
+                    && position_child < (Position)heap_.size();
+                    ++position_child) {
+                if (heap_[position_best].second > heap_[position_child].second)
+                    position_best = position_child;
+            }
+            if (position_best == position)
+                return;
+            swap(position, position_best);
+            position = position_best;
+        }
+    }
+
+};
+
+/** Check a heap against the reference heap. */
+void check(
+        Indexed4aryHeap<int64_t>& heap,
+        const Reference4aryHeap& reference_heap,
+        int64_t number_of_elements)
+{
+    const std::vector<std::pair<int64_t, int64_t>>& reference = reference_heap.heap();
+    ASSERT_EQ(heap.size(), (int64_t)reference.size());
+    std::vector<uint8_t> contained(number_of_elements, 0);
+    for (int64_t position = 0; position < heap.size(); ++position) {
+        std::pair<int64_t, int64_t> element = heap.top(position);
+        // Same array, so same tie order.
+        EXPECT_EQ(element, reference[position]);
+        // Heap invariant.
+        if (position > 0) {
+            EXPECT_LE(heap.top((position - 1) / 4).second, element.second);
+        }
+        // Positions.
+        EXPECT_TRUE(heap.contains(element.first));
+        EXPECT_EQ(heap.key(element.first), element.second);
+        contained[element.first] = 1;
+    }
+    for (int64_t index = 0; index < number_of_elements; ++index)
+        EXPECT_EQ(heap.contains(index), contained[index] == 1);
+}
+
+}
+
+TEST(Indexed4aryHeap, RandomOperations)
+{
+    std::mt19937_64 generator(0);
+    int64_t number_of_elements = 200;
+    // Few different keys, so that there are many ties.
+    std::uniform_int_distribution<int64_t> distribution_key(0, 20);
+    std::uniform_int_distribution<int64_t> distribution_index(0, number_of_elements - 1);
+    std::uniform_int_distribution<int> distribution_operation(0, 3);
+
+    std::vector<int64_t> keys(number_of_elements);
+    for (int64_t index = 0; index < number_of_elements; ++index)
+        keys[index] = distribution_key(generator);
+    Indexed4aryHeap<int64_t> heap(
+            number_of_elements,
+            [&keys](int64_t index) { return keys[index]; });
+    EXPECT_EQ(heap.size(), number_of_elements);
+    for (int64_t position = 1; position < heap.size(); ++position) {
+        EXPECT_LE(heap.top((position - 1) / 4).second, heap.top(position).second);
+    }
+
+    // Empty the heap, checking that the keys come out in order.
+    int64_t key_prev = -1;
+    while (!heap.empty()) {
+        EXPECT_LE(key_prev, heap.top().second);
+        key_prev = heap.top().second;
+        heap.pop();
+    }
+
+    Indexed4aryHeap<int64_t> heap_2(number_of_elements);
+    Reference4aryHeap reference_heap(number_of_elements);
+    for (int operation = 0; operation < 20000; ++operation) {
+        if (distribution_operation(generator) == 0 && !heap_2.empty()) {
+            heap_2.pop();
+            reference_heap.pop();
+        } else {
+            int64_t index = distribution_index(generator);
+            int64_t key = distribution_key(generator);
+            heap_2.update_key(index, key);
+            reference_heap.update_key(index, key);
+        }
+        check(heap_2, reference_heap, number_of_elements);
+    }
+}
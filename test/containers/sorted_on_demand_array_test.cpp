@@ -0,0 +1,112 @@
+#include "optimizationtools/containers/sorted_on_demand_array.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace optimizationtools;
+
+namespace
+{
+
+std::vector<Cost> random_costs(
+        ElementId number_of_elements,
+        Cost maximum_cost,
+        std::mt19937_64& generator)
+{
+    std::uniform_int_distribution<int64_t> distribution(0, maximum_cost);
+    std::vector<Cost> costs(number_of_elements);
+    for (ElementId id = 0; id < number_of_elements; ++id)
+        costs[id] = distribution(generator);
+    return costs;
+}
+
+}
+
+TEST(SortedOnDemandArray, Get)
+{
+    std::mt19937_64 generator(0);
+    ElementId number_of_elements = 10000;
+    std::vector<Cost> costs = random_costs(number_of_elements, 100000, generator);
+    std::vector<Cost> sorted_costs = costs;
+    std::sort(sorted_costs.begin(), sorted_costs.end());
+
+    SortedOnDemandArray array;
+    array.reset(number_of_elements);
+    for (ElementId id = 0; id < number_of_elements; ++id)
+        array.set_cost(id, costs[id]);
+    std::uniform_int_distribution<Position> distribution(0, number_of_elements - 1);
+    for (int i = 0; i < 1000; ++i) {
+        Position position = distribution(generator);
+        EXPECT_EQ(costs[array.get(position, generator)], sorted_costs[position]);
+    }
+}
+
+TEST(SortedOnDemandArray, GetRange)
+{
+    std::mt19937_64 generator(0);
+    ElementId number_of_elements = 10000;
+    // Many equal costs.
+    std::vector<Cost> costs = random_costs(number_of_elements, 10, generator);
+    std::vector<Cost> sorted_costs = costs;
+    std::sort(sorted_costs.begin(), sorted_costs.end());
+
+    SortedOnDemandArray array;
+    array.reset(number_of_elements);
+    for (ElementId id = 0; id < number_of_elements; ++id)
+        array.set_cost(id, costs[id]);
+    std::vector<ElementId> element_ids = array.get_range(1000, 3000, generator);
+    ASSERT_EQ(element_ids.size(), 2000);
+    for (Position position = 0; position < 2000; ++position)
+        EXPECT_EQ(costs[element_ids[position]], sorted_costs[1000 + position]);
+}
+
+TEST(SortedOnDemandArray, TopK)
+{
+    std::mt19937_64 generator(0);
+    ElementId number_of_elements = 10000;
+    std::vector<Cost> costs = random_costs(number_of_elements, 100000, generator);
+    std::vector<Cost> sorted_costs = costs;
+    std::sort(sorted_costs.begin(), sorted_costs.end());
+
+    SortedOnDemandArray array;
+    array.reset(number_of_elements);
+    for (ElementId id = 0; id < number_of_elements; ++id)
+        array.set_cost(id, costs[id]);
+    std::vector<ElementId> element_ids = array.top_k(500, generator);
+    ASSERT_EQ(element_ids.size(), 500);
+    std::vector<Cost> top_costs;
+    for (ElementId id: element_ids)
+        top_costs.push_back(costs[id]);
+    std::sort(top_costs.begin(), top_costs.end());
+    for (Position position = 0; position < 500; ++position)
+        EXPECT_EQ(top_costs[position], sorted_costs[position]);
+}
+
+TEST(SortedOnDemandArray, SetCostAfterQueries)
+{
+    std::mt19937_64 generator(0);
+    ElementId number_of_elements = 10000;
+    std::vector<Cost> costs = random_costs(number_of_elements, 1000, generator);
+
+    SortedOnDemandArray array;
+    array.reset(number_of_elements);
+    for (ElementId id = 0; id < number_of_elements; ++id)
+        array.set_cost(id, costs[id]);
+    std::uniform_int_distribution<ElementId> distribution_id(0, number_of_elements - 1);
+    std::uniform_int_distribution<int64_t> distribution_cost(0, 1000);
+    for (int iteration = 0; iteration < 20; ++iteration) {
+        array.get_range(0, 200, generator);
+        array.get(5000, generator);
+        for (int i = 0; i < 50; ++i) {
+            ElementId id = distribution_id(generator);
+            costs[id] = distribution_cost(generator);
+            array.set_cost(id, costs[id]);
+        }
+
+        std::vector<Cost> sorted_costs = costs;
+        std::sort(sorted_costs.begin(), sorted_costs.end());
+        std::vector<ElementId> element_ids = array.get_range(0, 300, generator);
+        for (Position position = 0; position < 300; ++position)
+            EXPECT_EQ(costs[element_ids[position]], sorted_costs[position]);
+        EXPECT_EQ(costs[array.get(7000, generator)], sorted_costs[7000]);
+    }
+}
@@ -0,0 +1,225 @@
+#include "optimizationtools/graph/adjacency_list_graph.hpp"
+
+#include "random_graph.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <fstream>
+#include <sstream>
+#include <set>
+#include <algorithm>
+#include <cstdint>
+
+using namespace optimizationtools;
+
+namespace
+{
+
+std::string file_content(const std::string& path)
+{
+    std::ifstream file(path);
+    std::stringstream ss;
+    ss << file.rdbuf();
+    return ss.str();
+}
+
+}
+
+TEST(AdjacencyListGraph, WriteParallel)
+{
+    std::mt19937_64 generator(0);
+    AdjacencyListGraph graph = random_graph_with_number_of_edges(
+            1000,
+            600000,
+            generator,
+            RandomGraphWeights::Random);
+    std::string path_1 = testing::TempDir() + "graph_1.txt";
+    std::string path_2 = testing::TempDir() + "graph_2.txt";
+    for (std::string format: {"snap", "matrixmarket", "dimacs"}) {
+        graph.write(path_1, format, 1);
+        graph.write(path_2, format, 3);
+        EXPECT_EQ(file_content(path_1), file_content(path_2));
+    }
+
+    AdjacencyListGraphBuilder graph_builder;
+    graph_builder.read(path_1, "dimacs");
+    AdjacencyListGraph graph_2 = graph_builder.build();
+    ASSERT_EQ(graph_2.number_of_edges(), graph.number_of_edges());
+    for (EdgeId edge_id = 0; edge_id < graph.number_of_edges(); ++edge_id) {
+        EXPECT_EQ(graph_2.first_end(edge_id), graph.first_end(edge_id));
+        EXPECT_EQ(graph_2.second_end(edge_id), graph.second_end(edge_id));
+    }
+}
+
+TEST(AdjacencyListGraph, WriteReadBinary)
+{
+    std::mt19937_64 generator(0);
+    AdjacencyListGraph graph = random_graph_with_number_of_edges(
+            1000,
+            100000,
+            generator,
+            RandomGraphWeights::Random);
+    std::string path = testing::TempDir() + "graph.bin";
+    graph.write(path, "binary");
+
+    AdjacencyListGraphBuilder graph_builder;
+    graph_builder.read(path, "binary");
+    AdjacencyListGraph graph_2 = graph_builder.build();
+    ASSERT_EQ(graph_2.number_of_vertices(), graph.number_of_vertices());
+    ASSERT_EQ(graph_2.number_of_edges(), graph.number_of_edges());
+    for (VertexId vertex_id = 0; vertex_id < graph.number_of_vertices(); ++vertex_id)
+        EXPECT_EQ(graph_2.weight(vertex_id), graph.weight(vertex_id));
+    for (EdgeId edge_id = 0; edge_id < graph.number_of_edges(); ++edge_id) {
+        EXPECT_EQ(graph_2.first_end(edge_id), graph.first_end(edge_id));
+        EXPECT_EQ(graph_2.second_end(edge_id), graph.second_end(edge_id));
+    }
+}
+
+TEST(AdjacencyListGraph, ReadBinaryCorruptHeader)
+{
+    std::mt19937_64 generator(0);
+    AdjacencyListGraph graph = random_graph_with_number_of_edges(
+            20,
+            50,
+            generator,
+            RandomGraphWeights::Random);
+    std::string path = testing::TempDir() + "graph.bin";
+    std::string corrupt_path = testing::TempDir() + "graph_corrupt.bin";
+    graph.write(path, "binary");
+
+    // Overwrite the number of vertices, then the number of edges.
+    for (std::streamoff position: {8, 16}) {
+        for (int64_t value: {(int64_t)-1, (int64_t)21, (int64_t)1 << 62, INT64_MAX}) {
+            {
+                std::ifstream file(path, std::ios::in | std::ios::binary);
+                std::ofstream corrupt_file(corrupt_path, std::ios::out | std::ios::binary);
+                corrupt_file << file.rdbuf();
+                corrupt_file.seekp(position);
+                corrupt_file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+            }
+            AdjacencyListGraphBuilder graph_builder;
+            EXPECT_THROW(graph_builder.read(corrupt_path, "binary"), std::runtime_error);
+        }
+    }
+}
+
+TEST(AdjacencyListGraph, RemoveDuplicateEdges)
+{
+    std::mt19937_64 generator(0);
+    VertexId number_of_vertices = 300;
+    std::uniform_int_distribution<VertexId> distribution(0, number_of_vertices - 1);
+    std::vector<std::pair<VertexId, VertexId>> edges;
+    for (EdgeId edge_id = 0; edge_id < 100000; ++edge_id)
+        edges.push_back({distribution(generator), distribution(generator)});
+
+    std::set<std::pair<VertexId, VertexId>> expected_edges;
+    for (const auto& edge: edges) {
+        if (edge.first != edge.second) {
+            expected_edges.insert({
+                    (std::min)(edge.first, edge.second),
+                    (std::max)(edge.first, edge.second)});
+        }
+    }
+
+    for (int number_of_threads: {1, 4}) {
+        AdjacencyListGraphBuilder graph_builder;
+        for (VertexId vertex_id = 0; vertex_id < number_of_vertices; ++vertex_id)
+            graph_builder.add_vertex();
+        for (const auto& edge: edges)
+            graph_builder.add_edge(edge.first, edge.second);
+        graph_builder.remove_duplicate_edges(number_of_threads);
+        AdjacencyListGraph graph = graph_builder.build();
+
+        ASSERT_EQ(graph.number_of_edges(), (EdgeId)expected_edges.size());
+        EdgeId edge_id = 0;
+        for (const auto& edge: expected_edges) {
+            EXPECT_EQ(graph.first_end(edge_id), edge.first);
+            EXPECT_EQ(graph.second_end(edge_id), edge.second);
+            edge_id++;
+        }
+        for (VertexId vertex_id = 0; vertex_id < number_of_vertices; ++vertex_id) {
+            const std::vector<VertexId>& neighbors = graph.vertex(vertex_id).neighbors;
+            EXPECT_TRUE(std::is_sorted(neighbors.begin(), neighbors.end()));
+            for (const AdjacencyListGraph::VertexEdge& vertex_edge: graph.edges(vertex_id))
+                EXPECT_EQ(graph.other_end(vertex_edge.edge_id, vertex_id), vertex_edge.vertex_id);
+        }
+    }
+}
+
+TEST(AdjacencyListGraph, BuildFromEdgeList)
+{
+    std::mt19937_64 generator(0);
+    VertexId number_of_vertices = 200;
+    std::uniform_int_distribution<VertexId> distribution(0, number_of_vertices - 1);
+    std::uniform_int_distribution<int> distribution_weight(1, 10);
+    std::vector<std::pair<VertexId, VertexId>> edges;
+    for (EdgeId edge_id = 0; edge_id < 5000; ++edge_id)
+        edges.push_back({distribution(generator), distribution(generator)});
+    std::vector<Weight> weights;
+    for (VertexId vertex_id = 0; vertex_id < number_of_vertices; ++vertex_id)
+        weights.push_back(distribution_weight(generator));
+
+    AdjacencyListGraphBuilder graph_builder;
+    graph_builder.reserve(number_of_vertices, edges.size());
+    for (VertexId vertex_id = 0; vertex_id < number_of_vertices; ++vertex_id)
+        graph_builder.add_vertex(weights[vertex_id]);
+    for (const auto& edge: edges)
+        graph_builder.add_edge(edge.first, edge.second);
+    AdjacencyListGraph expected_graph = graph_builder.build();
+
+    for (int number_of_threads: {1, 3}) {
+        AdjacencyListGraph graph = AdjacencyListGraphBuilder::build_from_edge_list(
+                number_of_vertices,
+                edges,
+                weights,
+                number_of_threads);
+        ASSERT_EQ(graph.number_of_vertices(), expected_graph.number_of_vertices());
+        ASSERT_EQ(graph.number_of_edges(), expected_graph.number_of_edges());
+        EXPECT_EQ(graph.total_weight(), expected_graph.total_weight());
+        EXPECT_EQ(graph.highest_degree(), expected_graph.highest_degree());
+        for (EdgeId edge_id = 0; edge_id < graph.number_of_edges(); ++edge_id) {
+            EXPECT_EQ(graph.first_end(edge_id), expected_graph.first_end(edge_id));
+            EXPECT_EQ(graph.second_end(edge_id), expected_graph.second_end(edge_id));
+        }
+        for (VertexId vertex_id = 0; vertex_id < number_of_vertices; ++vertex_id) {
+            EXPECT_EQ(graph.weight(vertex_id), expected_graph.weight(vertex_id));
+            EXPECT_EQ(graph.vertex(vertex_id).neighbors, expected_graph.vertex(vertex_id).neighbors);
+            ASSERT_EQ(graph.degree(vertex_id), expected_graph.degree(vertex_id));
+            for (VertexPos pos = 0; pos < graph.degree(vertex_id); ++pos) {
+                EXPECT_EQ(graph.edges(vertex_id)[pos].edge_id,
+                        expected_graph.edges(vertex_id)[pos].edge_id);
+            }
+        }
+    }
+
+    EXPECT_THROW(
+            AdjacencyListGraphBuilder::build_from_edge_list(2, {{0, 2}}),
+            std::invalid_argument);
+}
+
+TEST(AdjacencyListGraph, InducedSubgraph)
+{
+    std::mt19937_64 generator(0);
+    AdjacencyListGraph graph = random_graph(200, 0.1, generator, RandomGraphWeights::Random);
+    std::vector<VertexId> vertex_ids;
+    for (VertexId vertex_id = 0; vertex_id < graph.number_of_vertices(); vertex_id += 3)
+        vertex_ids.push_back(vertex_id);
+
+    AdjacencyListGraph subgraph = induced_subgraph(graph, vertex_ids);
+    ASSERT_EQ(subgraph.number_of_vertices(), (VertexId)vertex_ids.size());
+    EdgeId number_of_edges = 0;
+    for (VertexId vertex_id = 0; vertex_id < subgraph.number_of_vertices(); ++vertex_id) {
+        EXPECT_EQ(subgraph.weight(vertex_id), graph.weight(vertex_ids[vertex_id]));
+        std::vector<VertexId> expected_neighbors;
+        for (VertexId neighbor_id: graph.vertex(vertex_ids[vertex_id]).neighbors)
+            if (neighbor_id % 3 == 0)
+                expected_neighbors.push_back(neighbor_id / 3);
+        std::vector<VertexId> neighbors = subgraph.vertex(vertex_id).neighbors;
+        std::sort(expected_neighbors.begin(), expected_neighbors.end());
+        std::sort(neighbors.begin(), neighbors.end());
+        EXPECT_EQ(neighbors, expected_neighbors);
+        number_of_edges += expected_neighbors.size();
+    }
+    EXPECT_EQ(2 * subgraph.number_of_edges(), number_of_edges);
+}
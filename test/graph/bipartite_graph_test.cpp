@@ -0,0 +1,75 @@
+#include "optimizationtools/graph/bipartite_graph.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+using namespace optimizationtools;
+
+TEST(BipartiteGraph, MaximumMatchingMinimumCover)
+{
+    std::mt19937_64 generator(0);
+    VertexId number_of_vertices = 80;
+    std::bernoulli_distribution distribution(0.05);
+    AdjacencyListGraphBuilder graph_builder;
+    for (VertexId vertex_id = 0; vertex_id < number_of_vertices; ++vertex_id)
+        graph_builder.add_vertex();
+    for (VertexId vertex_1_id = 0; vertex_1_id < number_of_vertices; vertex_1_id += 2)
+        for (VertexId vertex_2_id = 1; vertex_2_id < number_of_vertices; vertex_2_id += 2)
+            if (distribution(generator))
+                graph_builder.add_edge(vertex_1_id, vertex_2_id);
+    AdjacencyListGraph graph = graph_builder.build();
+
+    BipartiteGraph bipartite_graph(graph);
+    EXPECT_EQ(bipartite_graph.vertices(0).size() + bipartite_graph.vertices(1).size(), number_of_vertices);
+    const std::vector<uint8_t>& matching = bipartite_graph.maximum_matching();
+    const std::vector<uint8_t>& cover = bipartite_graph.minimum_cover();
+
+    // The matching is a matching.
+    std::vector<EdgeId> vertices_number_of_matched_edges(number_of_vertices, 0);
+    EdgeId matching_size = 0;
+    for (EdgeId edge_id = 0; edge_id < graph.number_of_edges(); ++edge_id) {
+        if (matching[edge_id] == 0)
+            continue;
+        const AdjacencyListGraph::Edge& edge = graph.edge(edge_id);
+        vertices_number_of_matched_edges[edge.vertex_1_id]++;
+        vertices_number_of_matched_edges[edge.vertex_2_id]++;
+        EXPECT_EQ(bipartite_graph.matched_edge(edge.vertex_1_id), edge_id);
+        EXPECT_EQ(bipartite_graph.matched_edge(edge.vertex_2_id), edge_id);
+        matching_size++;
+    }
+    for (VertexId vertex_id = 0; vertex_id < number_of_vertices; ++vertex_id)
+        EXPECT_LE(vertices_number_of_matched_edges[vertex_id], 1);
+    EXPECT_EQ(bipartite_graph.matching_size(), matching_size);
+
+    // The cover is a cover; since its size is equal to the size of the
+    // matching, both are optimal.
+    VertexId cover_size = 0;
+    for (VertexId vertex_id = 0; vertex_id < number_of_vertices; ++vertex_id)
+        cover_size += cover[vertex_id];
+    for (EdgeId edge_id = 0; edge_id < graph.number_of_edges(); ++edge_id) {
+        const AdjacencyListGraph::Edge& edge = graph.edge(edge_id);
+        EXPECT_TRUE(cover[edge.vertex_1_id] || cover[edge.vertex_2_id]);
+    }
+    EXPECT_EQ(cover_size, matching_size);
+
+    // The free functions return the same results.
+    EXPECT_EQ(bipartite_graph_maximum_matching(graph), matching);
+    EXPECT_EQ(bipartite_graph_minimum_cover(graph), cover);
+    EXPECT_EQ(bipartite_graph_minimum_cover(graph, bipartite_graph.vertices_sides()), cover);
+}
+
+TEST(BipartiteGraph, NotBipartite)
+{
+    AdjacencyListGraphBuilder graph_builder;
+    for (VertexId vertex_id = 0; vertex_id < 5; ++vertex_id)
+        graph_builder.add_vertex();
+    for (VertexId vertex_id = 0; vertex_id < 5; ++vertex_id)
+        graph_builder.add_edge(vertex_id, (vertex_id + 1) % 5);
+    AdjacencyListGraph graph = graph_builder.build();
+    EXPECT_THROW(BipartiteGraph bipartite_graph(graph), std::invalid_argument);
+    EXPECT_THROW(bipartite_graph_minimum_cover(graph), std::invalid_argument);
+    EXPECT_THROW(
+            bipartite_graph_minimum_cover(graph, std::vector<uint8_t>(4, 0)),
+            std::invalid_argument);
+}
@@ -0,0 +1,197 @@
+#include "optimizationtools/graph/clique_graph.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <thread>
+#include <algorithm>
+
+using namespace optimizationtools;
+
+namespace
+{
+
+/** Build a clique graph with overlapping random cliques. */
+CliqueGraph random_clique_graph(
+        VertexId number_of_vertices,
+        CliqueId number_of_cliques,
+        VertexPos clique_size,
+        std::mt19937_64& generator,
+        bool materialize_neighbors = false)
+{
+    CliqueGraphBuilder graph_builder;
+    for (VertexId vertex_id = 0; vertex_id < number_of_vertices; ++vertex_id)
+        graph_builder.add_vertex();
+    std::vector<VertexId> vertices(number_of_vertices);
+    for (VertexId vertex_id = 0; vertex_id < number_of_vertices; ++vertex_id)
+        vertices[vertex_id] = vertex_id;
+    for (CliqueId clique_id = 0; clique_id < number_of_cliques; ++clique_id) {
+        std::shuffle(vertices.begin(), vertices.end(), generator);
+        graph_builder.add_clique(std::vector<VertexId>(
+                    vertices.begin(),
+                    vertices.begin() + clique_size));
+    }
+    return graph_builder.build(materialize_neighbors);
+}
+
+std::vector<VertexId> sorted_neighbors(
+        const CliqueGraph& graph,
+        VertexId vertex_id)
+{
+    std::vector<VertexId> neighbors;
+    graph.neighbors(vertex_id, neighbors);
+    std::sort(neighbors.begin(), neighbors.end());
+    return neighbors;
+}
+
+}
+
+TEST(CliqueGraph, ForEachNeighbor)
+{
+    std::mt19937_64 generator(0);
+    CliqueGraph graph = random_clique_graph(100, 50, 8, generator);
+
+    IndexedSet scratch(graph.number_of_vertices());
+    for (VertexId vertex_id = 0; vertex_id < graph.number_of_vertices(); ++vertex_id) {
+        // 'neighbors_begin' must be called before 'neighbors_end'.
+        auto it_begin = graph.neighbors_begin(vertex_id);
+        std::vector<VertexId> expected_neighbors(
+                it_begin,
+                graph.neighbors_end(vertex_id));
+        std::sort(expected_neighbors.begin(), expected_neighbors.end());
+
+        EXPECT_EQ(sorted_neighbors(graph, vertex_id), expected_neighbors);
+
+        std::vector<VertexId> neighbors;
+        graph.for_each_neighbor(
+                vertex_id,
+                [&neighbors](VertexId neighbor_id) { neighbors.push_back(neighbor_id); },
+                scratch);
+        std::sort(neighbors.begin(), neighbors.end());
+        EXPECT_EQ(neighbors, expected_neighbors);
+    }
+}
+
+TEST(CliqueGraph, NestedIteration)
+{
+    std::mt19937_64 generator(0);
+    CliqueGraph graph = random_clique_graph(100, 50, 8, generator);
+
+    // Count the triangles through each vertex with nested iterations.
+    for (VertexId vertex_id = 0; vertex_id < graph.number_of_vertices(); ++vertex_id) {
+        std::vector<VertexId> neighbors = sorted_neighbors(graph, vertex_id);
+        Counter number_of_triangles = 0;
+        Counter expected_number_of_triangles = 0;
+        graph.for_each_neighbor(
+                vertex_id,
+                [&graph, &neighbors, &number_of_triangles](VertexId neighbor_id)
+                {
+                    graph.for_each_neighbor(
+                            neighbor_id,
+                            [&neighbors, &number_of_triangles](VertexId neighbor_id_2)
+                            {
+                                if (std::binary_search(neighbors.begin(), neighbors.end(), neighbor_id_2))
+                                    number_of_triangles++;
+                            });
+                });
+        for (VertexId neighbor_id: neighbors) {
+            for (VertexId neighbor_id_2: sorted_neighbors(graph, neighbor_id))
+                if (std::binary_search(neighbors.begin(), neighbors.end(), neighbor_id_2))
+                    expected_number_of_triangles++;
+        }
+        EXPECT_EQ(number_of_triangles, expected_number_of_triangles);
+    }
+}
+
+TEST(CliqueGraph, ConcurrentIteration)
+{
+    std::mt19937_64 generator(0);
+    CliqueGraph graph = random_clique_graph(1000, 500, 20, generator);
+
+    std::vector<std::vector<VertexId>> expected_neighbors(graph.number_of_vertices());
+    for (VertexId vertex_id = 0; vertex_id < graph.number_of_vertices(); ++vertex_id)
+        expected_neighbors[vertex_id] = sorted_neighbors(graph, vertex_id);
+
+    int number_of_threads = 4;
+    std::vector<std::vector<std::vector<VertexId>>> threads_neighbors(
+            number_of_threads,
+            std::vector<std::vector<VertexId>>(graph.number_of_vertices()));
+    std::vector<std::thread> threads;
+    for (int thread_id = 0; thread_id < number_of_threads; ++thread_id) {
+        threads.push_back(std::thread(
+                    [&graph, &threads_neighbors, thread_id]()
+                    {
+                        for (VertexId vertex_id = 0;
+                                vertex_id < graph.number_of_vertices();
+                                ++vertex_id) {
+                            threads_neighbors[thread_id][vertex_id]
+                                = sorted_neighbors(graph, vertex_id);
+                        }
+                    }));
+    }
+    for (std::thread& thread: threads)
+        thread.join();
+
+    for (int thread_id = 0; thread_id < number_of_threads; ++thread_id)
+        EXPECT_EQ(threads_neighbors[thread_id], expected_neighbors);
+}
+
+TEST(CliqueGraph, MaterializedNeighbors)
+{
+    std::mt19937_64 generator(0);
+    CliqueGraph graph = random_clique_graph(100, 50, 8, generator);
+    generator.seed(0);
+    CliqueGraph graph_materialized = random_clique_graph(100, 50, 8, generator, true);
+    EXPECT_FALSE(graph.has_neighbors());
+    EXPECT_TRUE(graph_materialized.has_neighbors());
+
+    for (VertexId vertex_id = 0; vertex_id < graph.number_of_vertices(); ++vertex_id) {
+        std::vector<VertexId> expected_neighbors = sorted_neighbors(graph, vertex_id);
+        std::vector<VertexId> neighbors(
+                graph_materialized.neighbors_begin(vertex_id),
+                graph_materialized.neighbors_end(vertex_id));
+        // The materialized neighbors are sorted.
+        EXPECT_EQ(neighbors, expected_neighbors);
+        EXPECT_EQ(sorted_neighbors(graph_materialized, vertex_id), expected_neighbors);
+    }
+}
+
+TEST(CliqueGraph, MemoryBudget)
+{
+    CliqueGraphBuilder graph_builder;
+    for (VertexId vertex_id = 0; vertex_id < 4; ++vertex_id)
+        graph_builder.add_vertex();
+    graph_builder.add_clique({0, 1, 2});
+    graph_builder.add_clique({1, 2, 3});
+    // 5 offsets and 2 * 6 vertex ids, although only 5 edges are distinct.
+    std::size_t number_of_bytes = graph_builder.materialized_neighbors_number_of_bytes();
+    EXPECT_EQ(number_of_bytes, 5 * sizeof(EdgeId) + 12 * sizeof(VertexId));
+
+    CliqueGraphBuilder graph_builder_2 = graph_builder;
+    CliqueGraph graph = graph_builder.build_within_memory_budget(number_of_bytes - 1);
+    EXPECT_FALSE(graph.has_neighbors());
+    CliqueGraph graph_materialized = graph_builder_2.build_within_memory_budget(number_of_bytes);
+    EXPECT_TRUE(graph_materialized.has_neighbors());
+    EXPECT_EQ(sorted_neighbors(graph_materialized, 0), (std::vector<VertexId>{1, 2}));
+    EXPECT_EQ(sorted_neighbors(graph_materialized, 1), (std::vector<VertexId>{0, 2, 3}));
+}
+
+TEST(CliqueGraph, HasEdge)
+{
+    std::mt19937_64 generator(0);
+    CliqueGraph graph = random_clique_graph(100, 50, 8, generator);
+    generator.seed(0);
+    CliqueGraph graph_materialized = random_clique_graph(100, 50, 8, generator, true);
+
+    for (VertexId vertex_1_id = 0; vertex_1_id < graph.number_of_vertices(); ++vertex_1_id) {
+        std::vector<VertexId> neighbors = sorted_neighbors(graph, vertex_1_id);
+        for (VertexId vertex_2_id = 0; vertex_2_id < graph.number_of_vertices(); ++vertex_2_id) {
+            bool expected_has_edge = std::binary_search(
+                    neighbors.begin(),
+                    neighbors.end(),
+                    vertex_2_id);
+            EXPECT_EQ(graph.has_edge(vertex_1_id, vertex_2_id), expected_has_edge);
+            EXPECT_EQ(graph_materialized.has_edge(vertex_1_id, vertex_2_id), expected_has_edge);
+        }
+    }
+}
@@ -0,0 +1,143 @@
+#include "optimizationtools/graph/clique_partition_reduction.hpp"
+
+#include "random_graph.hpp"
+
+#include "optimizationtools/graph/clique.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+using namespace optimizationtools;
+
+namespace
+{
+
+std::vector<std::vector<uint8_t>> adjacency_matrix(const AdjacencyListGraph& graph)
+{
+    std::vector<std::vector<uint8_t>> matrix(
+            graph.number_of_vertices(),
+            std::vector<uint8_t>(graph.number_of_vertices(), 0));
+    for (EdgeId edge_id = 0; edge_id < graph.number_of_edges(); ++edge_id) {
+        matrix[graph.first_end(edge_id)][graph.second_end(edge_id)] = 1;
+        matrix[graph.second_end(edge_id)][graph.first_end(edge_id)] = 1;
+    }
+    return matrix;
+}
+
+bool is_vertex_clique_partition(
+        const AdjacencyListGraph& graph,
+        const std::vector<std::vector<VertexId>>& cliques)
+{
+    std::vector<std::vector<uint8_t>> matrix = adjacency_matrix(graph);
+    std::vector<Counter> vertices_number_of_cliques(graph.number_of_vertices(), 0);
+    for (const std::vector<VertexId>& clique: cliques) {
+        for (VertexId vertex_1_id: clique) {
+            vertices_number_of_cliques[vertex_1_id]++;
+            for (VertexId vertex_2_id: clique)
+                if (vertex_1_id != vertex_2_id && !matrix[vertex_1_id][vertex_2_id])
+                    return false;
+        }
+    }
+    for (VertexId vertex_id = 0; vertex_id < graph.number_of_vertices(); ++vertex_id)
+        if (vertices_number_of_cliques[vertex_id] != 1)
+            return false;
+    return true;
+}
+
+/** Compute the minimum number of cliques of a vertex clique partition. */
+void minimum_vertex_clique_partition_rec(
+        const std::vector<std::vector<uint8_t>>& matrix,
+        VertexId vertex_id,
+        std::vector<std::vector<VertexId>>& cliques,
+        VertexId& best)
+{
+    if ((VertexId)cliques.size() >= best)
+        return;
+    if (vertex_id == (VertexId)matrix.size()) {
+        best = cliques.size();
+        return;
+    }
+    // The recursive calls add cliques, so the cliques are accessed by
+    // position.
+    for (VertexPos clique_pos = 0; clique_pos < (VertexPos)cliques.size(); ++clique_pos) {
+        bool ok = true;
+        for (VertexId clique_vertex_id: cliques[clique_pos])
+            if (!matrix[vertex_id][clique_vertex_id])
+                ok = false;
+        if (!ok)
+            continue;
+        cliques[clique_pos].push_back(vertex_id);
+        minimum_vertex_clique_partition_rec(matrix, vertex_id + 1, cliques, best);
+        cliques[clique_pos].pop_back();
+    }
+    cliques.push_back({vertex_id});
+    minimum_vertex_clique_partition_rec(matrix, vertex_id + 1, cliques, best);
+    cliques.pop_back();
+}
+
+VertexId minimum_vertex_clique_partition(const AdjacencyListGraph& graph)
+{
+    std::vector<std::vector<VertexId>> cliques;
+    VertexId best = graph.number_of_vertices();
+    minimum_vertex_clique_partition_rec(adjacency_matrix(graph), 0, cliques, best);
+    return best;
+}
+
+}
+
+TEST(CliquePartitionReduction, Tree)
+{
+    // A tree is entirely reduced by the pendant and isolated vertex rules.
+    std::mt19937_64 generator(0);
+    AdjacencyListGraphBuilder graph_builder;
+    graph_builder.add_vertex();
+    for (VertexId vertex_id = 1; vertex_id < 100; ++vertex_id) {
+        graph_builder.add_vertex();
+        std::uniform_int_distribution<VertexId> distribution(0, vertex_id - 1);
+        graph_builder.add_edge(vertex_id, distribution(generator));
+    }
+    AdjacencyListGraph graph = graph_builder.build();
+
+    VertexCliquePartitionReduction reduction(graph);
+    EXPECT_EQ(reduction.kernel().number_of_vertices(), 0);
+    std::vector<std::vector<VertexId>> cliques = reduction.lift({});
+    EXPECT_TRUE(is_vertex_clique_partition(graph, cliques));
+    EXPECT_EQ((VertexId)cliques.size(), reduction.number_of_cliques());
+}
+
+TEST(CliquePartitionReduction, Lift)
+{
+    std::mt19937_64 generator(0);
+    for (double density: {0.01, 0.02, 0.05, 0.2}) {
+        AdjacencyListGraph graph = random_graph(300, density, generator);
+        VertexCliquePartitionReduction reduction(graph);
+        EXPECT_LE(reduction.kernel().number_of_vertices(), graph.number_of_vertices());
+        EXPECT_EQ(
+                reduction.kernel().number_of_vertices()
+                + reduction.number_of_removed_vertices(VertexCliquePartitionReduction::Rule::Isolated)
+                + reduction.number_of_removed_vertices(VertexCliquePartitionReduction::Rule::Pendant)
+                + reduction.number_of_removed_vertices(VertexCliquePartitionReduction::Rule::Domination),
+                graph.number_of_vertices());
+
+        std::vector<std::vector<VertexId>> kernel_cliques
+            = vertex_clique_partition_1(reduction.kernel());
+        std::vector<std::vector<VertexId>> cliques = reduction.lift(kernel_cliques);
+        EXPECT_TRUE(is_vertex_clique_partition(graph, cliques));
+        EXPECT_EQ(cliques.size(), kernel_cliques.size() + reduction.number_of_cliques());
+    }
+}
+
+TEST(CliquePartitionReduction, Exact)
+{
+    std::mt19937_64 generator(0);
+    for (int instance_id = 0; instance_id < 40; ++instance_id) {
+        double density = 0.1 + 0.2 * (instance_id % 4);
+        AdjacencyListGraph graph = random_graph(11, density, generator);
+        VertexCliquePartitionReduction reduction(graph);
+        EXPECT_EQ(
+                minimum_vertex_clique_partition(graph),
+                minimum_vertex_clique_partition(reduction.kernel())
+                + reduction.number_of_cliques());
+    }
+}
@@ -0,0 +1,276 @@
+#include "optimizationtools/graph/clique.hpp"
+#include "optimizationtools/graph/k_core.hpp"
+#include "optimizationtools/graph/clique_graph.hpp"
+
+#include "random_graph.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <algorithm>
+
+using namespace optimizationtools;
+
+namespace
+{
+
+bool is_clique(
+        const AdjacencyListGraph& graph,
+        const std::vector<VertexId>& clique)
+{
+    for (VertexId vertex_1_id: clique) {
+        for (VertexId vertex_2_id: clique) {
+            if (vertex_1_id == vertex_2_id)
+                continue;
+            if (std::find(
+                        graph.neighbors_begin(vertex_1_id),
+                        graph.neighbors_end(vertex_1_id),
+                        vertex_2_id) == graph.neighbors_end(vertex_1_id)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/** Compute the weight of a maximum-weight clique by enumeration. */
+Weight maximum_weight_clique_brute_force(const AdjacencyListGraph& graph)
+{
+    VertexId number_of_vertices = graph.number_of_vertices();
+    Weight best_weight = 0;
+    for (uint64_t subset = 1; subset < ((uint64_t)1 << number_of_vertices); ++subset) {
+        std::vector<VertexId> vertices;
+        Weight weight = 0;
+        for (VertexId vertex_id = 0; vertex_id < number_of_vertices; ++vertex_id) {
+            if (subset & ((uint64_t)1 << vertex_id)) {
+                vertices.push_back(vertex_id);
+                weight += graph.weight(vertex_id);
+            }
+        }
+        if (weight > best_weight && is_clique(graph, vertices))
+            best_weight = weight;
+    }
+    return best_weight;
+}
+
+}
+
+TEST(Clique, VertexCliqueCover)
+{
+    std::mt19937_64 generator(0);
+    AdjacencyListGraph graph = random_graph(300, 0.1, generator);
+
+    std::vector<std::vector<VertexId>> cliques = vertex_clique_cover(graph);
+    std::vector<uint8_t> vertices_covered(graph.number_of_vertices(), 0);
+    for (const std::vector<VertexId>& clique: cliques) {
+        EXPECT_TRUE(is_clique(graph, clique));
+        for (VertexId vertex_id: clique)
+            vertices_covered[vertex_id] = 1;
+    }
+    for (VertexId vertex_id = 0; vertex_id < graph.number_of_vertices(); ++vertex_id)
+        EXPECT_EQ(vertices_covered[vertex_id], 1);
+
+    // The result doesn't depend on the number of threads.
+    EXPECT_EQ(vertex_clique_cover(graph, 4), cliques);
+}
+
+TEST(Clique, CliqueCoversGraphTypes)
+{
+    std::mt19937_64 generator(0);
+    AdjacencyListGraph graph = random_graph(100, 0.2, generator, RandomGraphWeights::Random);
+    // Same graph, with one clique per edge.
+    CliqueGraphBuilder clique_graph_builder;
+    for (VertexId vertex_id = 0; vertex_id < graph.number_of_vertices(); ++vertex_id)
+        clique_graph_builder.add_vertex(graph.weight(vertex_id));
+    for (EdgeId edge_id = 0; edge_id < graph.number_of_edges(); ++edge_id)
+        clique_graph_builder.add_clique({graph.first_end(edge_id), graph.second_end(edge_id)});
+    CliqueGraph clique_graph = clique_graph_builder.build();
+    const AbstractGraph& abstract_graph = graph;
+
+    std::vector<std::vector<VertexId>> edge_cliques = edge_clique_cover(graph);
+    std::vector<std::vector<EdgeId>> edges_covered(
+            graph.number_of_vertices(),
+            std::vector<EdgeId>(graph.number_of_vertices(), 0));
+    for (const std::vector<VertexId>& clique: edge_cliques) {
+        EXPECT_TRUE(is_clique(graph, clique));
+        for (VertexId vertex_1_id: clique)
+            for (VertexId vertex_2_id: clique)
+                edges_covered[vertex_1_id][vertex_2_id] = 1;
+    }
+    for (EdgeId edge_id = 0; edge_id < graph.number_of_edges(); ++edge_id)
+        EXPECT_EQ(edges_covered[graph.first_end(edge_id)][graph.second_end(edge_id)], 1);
+    EXPECT_EQ(edge_clique_cover(clique_graph), edge_cliques);
+    EXPECT_EQ(edge_clique_cover(abstract_graph), edge_cliques);
+
+    std::vector<std::vector<VertexId>> vertex_cliques = vertex_clique_cover(graph);
+    EXPECT_EQ(vertex_clique_cover(clique_graph), vertex_cliques);
+    EXPECT_EQ(vertex_clique_cover(clique_graph, 3), vertex_cliques);
+    EXPECT_EQ(vertex_clique_cover(abstract_graph, 3), vertex_cliques);
+}
+
+TEST(Clique, EdgeCliquePartition)
+{
+    std::mt19937_64 generator(0);
+    AdjacencyListGraph graph = random_graph(200, 0.2, generator);
+
+    std::vector<std::vector<VertexId>> cliques = edge_clique_partition(graph);
+    std::vector<std::vector<Counter>> edges_number_of_cliques(
+            graph.number_of_vertices(),
+            std::vector<Counter>(graph.number_of_vertices(), 0));
+    for (const std::vector<VertexId>& clique: cliques) {
+        EXPECT_TRUE(is_clique(graph, clique));
+        for (VertexId vertex_1_id: clique)
+            for (VertexId vertex_2_id: clique)
+                edges_number_of_cliques[vertex_1_id][vertex_2_id]++;
+    }
+    for (EdgeId edge_id = 0; edge_id < graph.number_of_edges(); ++edge_id) {
+        EXPECT_EQ(edges_number_of_cliques
+                [graph.first_end(edge_id)]
+                [graph.second_end(edge_id)], 1);
+    }
+}
+
+TEST(Clique, VertexCliquePartition1)
+{
+    std::mt19937_64 generator(0);
+    AdjacencyListGraph graph = random_graph(300, 0.3, generator);
+
+    std::vector<std::vector<VertexId>> cliques = vertex_clique_partition_1(graph);
+    std::vector<Counter> vertices_number_of_cliques(graph.number_of_vertices(), 0);
+    for (const std::vector<VertexId>& clique: cliques) {
+        EXPECT_TRUE(is_clique(graph, clique));
+        for (VertexId vertex_id: clique)
+            vertices_number_of_cliques[vertex_id]++;
+    }
+    for (VertexId vertex_id = 0; vertex_id < graph.number_of_vertices(); ++vertex_id)
+        EXPECT_EQ(vertices_number_of_cliques[vertex_id], 1);
+}
+
+TEST(Clique, VertexCliquePartition1AbstractGraph)
+{
+    std::mt19937_64 generator(0);
+    AdjacencyListGraph graph = random_graph(300, 0.3, generator);
+    const AbstractGraph& abstract_graph = graph;
+
+    EXPECT_EQ(
+            vertex_clique_partition_1(graph),
+            vertex_clique_partition_1(abstract_graph));
+}
+
+TEST(Clique, MaximumWeightClique)
+{
+    std::mt19937_64 generator(0);
+    std::uniform_int_distribution<int> weight_distribution(-2, 10);
+    for (int instance_id = 0; instance_id < 50; ++instance_id) {
+        VertexId number_of_vertices = 14;
+        double density = 0.2 + 0.6 * (instance_id % 4) / 3;
+        std::bernoulli_distribution distribution(density);
+        AdjacencyListGraphBuilder graph_builder;
+        for (VertexId vertex_id = 0; vertex_id < number_of_vertices; ++vertex_id)
+            graph_builder.add_vertex(weight_distribution(generator));
+        for (VertexId vertex_1_id = 0; vertex_1_id < number_of_vertices; ++vertex_1_id)
+            for (VertexId vertex_2_id = vertex_1_id + 1; vertex_2_id < number_of_vertices; ++vertex_2_id)
+                if (distribution(generator))
+                    graph_builder.add_edge(vertex_1_id, vertex_2_id);
+        AdjacencyListGraph graph = graph_builder.build();
+        Weight expected_weight = maximum_weight_clique_brute_force(graph);
+
+        for (int number_of_threads: {1, 3}) {
+            MaximumWeightCliqueParameters parameters;
+            parameters.verbosity_level = 0;
+            parameters.number_of_threads = number_of_threads;
+            MaximumWeightCliqueOutput output = maximum_weight_clique(graph, parameters);
+            EXPECT_TRUE(is_clique(graph, output.clique));
+            Weight weight = 0;
+            for (VertexId vertex_id: output.clique)
+                weight += graph.weight(vertex_id);
+            EXPECT_EQ(output.weight, weight);
+            EXPECT_EQ(output.weight, expected_weight);
+            EXPECT_EQ(output.bound, expected_weight);
+        }
+    }
+}
+
+TEST(Clique, MaximumWeightCliquePlanted)
+{
+    // Dense graph with a planted clique whose vertices are much heavier than
+    // the others. Each other vertex is not adjacent to some vertex of the
+    // planted clique, and the total weight of the other vertices is smaller
+    // than the weight of any planted vertex, so the planted clique is the
+    // unique maximum-weight clique.
+    std::mt19937_64 generator(0);
+    VertexId number_of_vertices = 150;
+    VertexId planted_clique_size = 20;
+    std::vector<VertexId> vertices(number_of_vertices);
+    for (VertexId vertex_id = 0; vertex_id < number_of_vertices; ++vertex_id)
+        vertices[vertex_id] = vertex_id;
+    std::shuffle(vertices.begin(), vertices.end(), generator);
+    std::vector<uint8_t> is_planted(number_of_vertices, 0);
+    for (VertexPos pos = 0; pos < planted_clique_size; ++pos)
+        is_planted[vertices[pos]] = 1;
+
+    std::uniform_int_distribution<int> distribution_weight(1, 10);
+    std::uniform_int_distribution<int> distribution_planted_weight(1500, 2000);
+    std::uniform_int_distribution<VertexPos> distribution_planted_pos(0, planted_clique_size - 1);
+    std::bernoulli_distribution distribution(0.7);
+    AdjacencyListGraphBuilder graph_builder;
+    Weight expected_weight = 0;
+    for (VertexId vertex_id = 0; vertex_id < number_of_vertices; ++vertex_id) {
+        Weight weight = (is_planted[vertex_id])?
+            distribution_planted_weight(generator):
+            distribution_weight(generator);
+        graph_builder.add_vertex(weight);
+        if (is_planted[vertex_id])
+            expected_weight += weight;
+    }
+    std::vector<VertexId> vertices_non_neighbor(number_of_vertices, -1);
+    for (VertexId vertex_id = 0; vertex_id < number_of_vertices; ++vertex_id)
+        if (!is_planted[vertex_id])
+            vertices_non_neighbor[vertex_id] = vertices[distribution_planted_pos(generator)];
+    for (VertexId vertex_1_id = 0; vertex_1_id < number_of_vertices; ++vertex_1_id) {
+        for (VertexId vertex_2_id = vertex_1_id + 1; vertex_2_id < number_of_vertices; ++vertex_2_id) {
+            if (is_planted[vertex_1_id] && is_planted[vertex_2_id]) {
+                graph_builder.add_edge(vertex_1_id, vertex_2_id);
+            } else if (vertices_non_neighbor[vertex_1_id] != vertex_2_id
+                    && vertices_non_neighbor[vertex_2_id] != vertex_1_id
+                    && distribution(generator)) {
+                graph_builder.add_edge(vertex_1_id, vertex_2_id);
+            }
+        }
+    }
+    AdjacencyListGraph graph = graph_builder.build();
+    // Some subproblems have more than 64 candidates, so that their bitsets
+    // have several words.
+    EXPECT_GT(core_decomposition(graph).degeneracy, 64);
+
+    std::vector<VertexId> expected_clique;
+    for (VertexId vertex_id = 0; vertex_id < number_of_vertices; ++vertex_id)
+        if (is_planted[vertex_id])
+            expected_clique.push_back(vertex_id);
+    for (int number_of_threads: {1, 3}) {
+        MaximumWeightCliqueParameters parameters;
+        parameters.verbosity_level = 0;
+        parameters.number_of_threads = number_of_threads;
+        MaximumWeightCliqueOutput output = maximum_weight_clique(graph, parameters);
+        EXPECT_TRUE(is_clique(graph, output.clique));
+        std::vector<VertexId> clique = output.clique;
+        std::sort(clique.begin(), clique.end());
+        EXPECT_EQ(clique, expected_clique);
+        EXPECT_EQ(output.weight, expected_weight);
+        EXPECT_EQ(output.bound, expected_weight);
+    }
+}
+
+TEST(Clique, MaximumWeightCliqueTimeLimit)
+{
+    std::mt19937_64 generator(0);
+    AdjacencyListGraph graph = random_graph(300, 0.5, generator);
+
+    MaximumWeightCliqueParameters parameters;
+    parameters.verbosity_level = 0;
+    parameters.timer.set_time_limit(0);
+    MaximumWeightCliqueOutput output = maximum_weight_clique(graph, parameters);
+    EXPECT_TRUE(is_clique(graph, output.clique));
+    EXPECT_EQ(output.weight, (Weight)output.clique.size());
+    EXPECT_GE(output.bound, output.weight);
+}
@@ -0,0 +1,118 @@
+#include "optimizationtools/graph/coloring.hpp"
+
+#include "random_graph.hpp"
+
+#include "optimizationtools/graph/complement_graph_view.hpp"
+#include "optimizationtools/graph/k_core.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace optimizationtools;
+
+namespace
+{
+
+template <typename Graph>
+bool is_coloring(
+        const Graph& graph,
+        const Coloring& coloring)
+{
+    for (VertexId vertex_id = 0; vertex_id < graph.number_of_vertices(); ++vertex_id) {
+        ColorId color = coloring.colors[vertex_id];
+        if (color < 0 || color >= coloring.number_of_colors)
+            return false;
+        bool conflict = false;
+        graph.for_each_neighbor(
+                vertex_id,
+                [&coloring, &conflict, color](VertexId neighbor_id)
+                {
+                    if (coloring.colors[neighbor_id] == color)
+                        conflict = true;
+                });
+        if (conflict)
+            return false;
+    }
+    return true;
+}
+
+}
+
+TEST(Coloring, GreedyColoring)
+{
+    std::mt19937_64 generator(0);
+    AdjacencyListGraph graph = random_graph(300, 0.1, generator);
+
+    for (ColoringOrdering ordering: {
+            ColoringOrdering::Natural,
+            ColoringOrdering::LargestFirst,
+            ColoringOrdering::SmallestLast}) {
+        Coloring coloring = greedy_coloring(graph, ordering);
+        EXPECT_TRUE(is_coloring(graph, coloring));
+        EXPECT_LE(coloring.number_of_colors, graph.highest_degree() + 1);
+    }
+    Coloring coloring = greedy_coloring(graph, generator);
+    EXPECT_TRUE(is_coloring(graph, coloring));
+
+    CoreDecomposition core_decomposition = optimizationtools::core_decomposition(graph);
+    EXPECT_LE(
+            greedy_coloring(graph, ColoringOrdering::SmallestLast).number_of_colors,
+            core_decomposition.degeneracy + 1);
+}
+
+TEST(Coloring, DsaturColoring)
+{
+    std::mt19937_64 generator(0);
+    AdjacencyListGraph graph = random_graph(300, 0.1, generator);
+    Coloring coloring = dsatur_coloring(graph);
+    EXPECT_TRUE(is_coloring(graph, coloring));
+
+    ComplementGraphView complement_graph(graph);
+    Coloring complement_coloring = dsatur_coloring(complement_graph);
+    EXPECT_TRUE(is_coloring(complement_graph, complement_coloring));
+}
+
+TEST(Coloring, DsaturColoringManyColors)
+{
+    // The colors of a clique of 70 vertices don't fit in a single word, and
+    // the colors of the clique are larger than the bitsets of the pendant
+    // vertices attached to it.
+    AdjacencyListGraphBuilder graph_builder;
+    VertexId clique_size = 70;
+    for (VertexId vertex_id = 0; vertex_id < 2 * clique_size; ++vertex_id)
+        graph_builder.add_vertex();
+    for (VertexId vertex_1_id = 0; vertex_1_id < clique_size; ++vertex_1_id) {
+        for (VertexId vertex_2_id = vertex_1_id + 1; vertex_2_id < clique_size; ++vertex_2_id)
+            graph_builder.add_edge(vertex_1_id, vertex_2_id);
+        graph_builder.add_edge(vertex_1_id, clique_size + vertex_1_id);
+        if (vertex_1_id > 0)
+            graph_builder.add_edge(vertex_1_id, clique_size + vertex_1_id - 1);
+    }
+    AdjacencyListGraph graph = graph_builder.build();
+
+    Coloring coloring = dsatur_coloring(graph);
+    EXPECT_TRUE(is_coloring(graph, coloring));
+    EXPECT_EQ(coloring.number_of_colors, clique_size);
+}
+
+TEST(Coloring, DsaturColoringBipartiteGraphs)
+{
+    // DSATUR is exact on bipartite graphs. In a crown graph whose sides are
+    // interleaved, the greedy coloring in natural order uses one color per
+    // pair of vertices.
+    AdjacencyListGraphBuilder graph_builder;
+    VertexId number_of_vertices = 12;
+    for (VertexId vertex_id = 0; vertex_id < 2 * number_of_vertices; ++vertex_id)
+        graph_builder.add_vertex();
+    for (VertexId vertex_1_id = 0; vertex_1_id < number_of_vertices; ++vertex_1_id)
+        for (VertexId vertex_2_id = 0; vertex_2_id < number_of_vertices; ++vertex_2_id)
+            if (vertex_1_id != vertex_2_id)
+                graph_builder.add_edge(2 * vertex_1_id, 2 * vertex_2_id + 1);
+    AdjacencyListGraph graph = graph_builder.build();
+
+    Coloring coloring = dsatur_coloring(graph);
+    EXPECT_TRUE(is_coloring(graph, coloring));
+    EXPECT_EQ(coloring.number_of_colors, 2);
+    EXPECT_EQ(
+            greedy_coloring(graph, ColoringOrdering::Natural).number_of_colors,
+            number_of_vertices);
+}
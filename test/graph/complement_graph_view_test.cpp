@@ -0,0 +1,40 @@
+#include "optimizationtools/graph/complement_graph_view.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+using namespace optimizationtools;
+
+TEST(ComplementGraphView, SameAsComplementary)
+{
+    std::mt19937_64 generator(0);
+    AdjacencyListGraphBuilder graph_builder;
+    VertexId number_of_vertices = 100;
+    for (VertexId vertex_id = 0; vertex_id < number_of_vertices; ++vertex_id)
+        graph_builder.add_vertex();
+    std::uniform_int_distribution<VertexId> distribution(0, number_of_vertices - 1);
+    for (EdgeId edge_id = 0; edge_id < 1000; ++edge_id)
+        graph_builder.add_edge(distribution(generator), distribution(generator));
+    graph_builder.remove_duplicate_edges();
+    AdjacencyListGraph graph = graph_builder.build();
+
+    AdjacencyListGraph complementary_graph = graph.complementary();
+    ComplementGraphView complement_graph_view(graph);
+    EXPECT_EQ(complement_graph_view.number_of_edges(), complementary_graph.number_of_edges());
+    EXPECT_EQ(complement_graph_view.highest_degree(), complementary_graph.highest_degree());
+    for (VertexId vertex_id = 0; vertex_id < number_of_vertices; ++vertex_id) {
+        EXPECT_EQ(complement_graph_view.degree(vertex_id), complementary_graph.degree(vertex_id));
+
+        std::vector<VertexId> neighbors_1(
+                complementary_graph.neighbors_begin(vertex_id),
+                complementary_graph.neighbors_end(vertex_id));
+        std::sort(neighbors_1.begin(), neighbors_1.end());
+        std::vector<VertexId> neighbors_2;
+        for (VertexId vertex_id_2: complement_graph_view.neighbors(vertex_id)) {
+            neighbors_2.push_back(vertex_id_2);
+            EXPECT_TRUE(complement_graph_view.has_edge(vertex_id, vertex_id_2));
+        }
+        EXPECT_EQ(neighbors_1, neighbors_2);
+    }
+}
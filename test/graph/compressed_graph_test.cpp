@@ -0,0 +1,101 @@
+#include "optimizationtools/graph/compressed_graph.hpp"
+#include "optimizationtools/graph/adjacency_list_graph.hpp"
+#include "optimizationtools/graph/clique.hpp"
+
+#include "random_graph.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <algorithm>
+
+using namespace optimizationtools;
+
+TEST(CompressedGraph, EncodeDecode)
+{
+    std::vector<uint64_t> values = {0, 1, 127, 128, 16383, 16384, ((uint64_t)1 << 40) + 3, ~(uint64_t)0};
+    std::vector<uint8_t> data;
+    for (uint64_t value: values)
+        CompressedGraph::encode(value, data);
+    const uint8_t* pointer = data.data();
+    for (uint64_t value: values)
+        EXPECT_EQ(CompressedGraph::decode(pointer), value);
+    EXPECT_EQ(pointer, data.data() + data.size());
+}
+
+TEST(CompressedGraph, SameAsAdjacencyListGraph)
+{
+    std::mt19937_64 generator(0);
+    AdjacencyListGraph graph = random_graph_with_number_of_edges(
+            500,
+            5000,
+            generator,
+            RandomGraphWeights::Random,
+            true);
+    CompressedGraph compressed_graph(graph);
+
+    ASSERT_EQ(compressed_graph.number_of_vertices(), graph.number_of_vertices());
+    EXPECT_EQ(compressed_graph.number_of_edges(), graph.number_of_edges());
+    EXPECT_EQ(compressed_graph.highest_degree(), graph.highest_degree());
+    EXPECT_EQ(compressed_graph.total_weight(), graph.total_weight());
+    std::vector<VertexId> neighbors_tmp;
+    for (VertexId vertex_id = 0; vertex_id < graph.number_of_vertices(); ++vertex_id) {
+        EXPECT_EQ(compressed_graph.degree(vertex_id), graph.degree(vertex_id));
+        EXPECT_EQ(compressed_graph.weight(vertex_id), graph.weight(vertex_id));
+
+        std::vector<VertexId> neighbors_1 = graph.vertex(vertex_id).neighbors;
+        std::sort(neighbors_1.begin(), neighbors_1.end());
+        std::vector<VertexId> neighbors_2;
+        for (VertexId neighbor_id: compressed_graph.neighbors(vertex_id))
+            neighbors_2.push_back(neighbor_id);
+        EXPECT_EQ(neighbors_2, neighbors_1);
+        std::vector<VertexId> neighbors_3;
+        compressed_graph.for_each_neighbor(
+                vertex_id,
+                [&neighbors_3](VertexId neighbor_id) { neighbors_3.push_back(neighbor_id); });
+        EXPECT_EQ(neighbors_3, neighbors_1);
+        EXPECT_EQ(compressed_graph.neighbors(vertex_id, neighbors_tmp), neighbors_1);
+        auto it_begin = compressed_graph.neighbors_begin(vertex_id);
+        std::vector<VertexId> neighbors_4(
+                it_begin,
+                compressed_graph.neighbors_end(vertex_id));
+        EXPECT_EQ(neighbors_4, neighbors_1);
+    }
+
+    std::uniform_int_distribution<VertexId> distribution(0, graph.number_of_vertices() - 1);
+    for (Counter iteration = 0; iteration < 1000; ++iteration) {
+        VertexId vertex_id_1 = distribution(generator);
+        VertexId vertex_id_2 = distribution(generator);
+        const std::vector<VertexId>& neighbors = graph.vertex(vertex_id_1).neighbors;
+        EXPECT_EQ(
+                compressed_graph.has_edge(vertex_id_1, vertex_id_2),
+                std::find(neighbors.begin(), neighbors.end(), vertex_id_2) != neighbors.end());
+    }
+
+    // Each gap is smaller than 500, so it fits in at most 2 bytes.
+    EXPECT_LE(
+            compressed_graph.number_of_bytes(),
+            (std::size_t)(2 * 2 * graph.number_of_edges() + 2 * graph.number_of_vertices()));
+
+    EXPECT_EQ(
+            vertex_clique_partition_1(compressed_graph),
+            vertex_clique_partition_1(graph));
+}
+
+TEST(CompressedGraph, Builder)
+{
+    CompressedGraphBuilder graph_builder;
+    graph_builder.add_vertex({2, 1, 2, 0});
+    graph_builder.add_vertex({0});
+    graph_builder.add_vertex({0});
+    CompressedGraph graph = graph_builder.build();
+    EXPECT_EQ(graph.number_of_vertices(), 3);
+    EXPECT_EQ(graph.number_of_edges(), 2);
+    EXPECT_EQ(graph.degree(0), 2);
+    EXPECT_EQ(graph.total_weight(), 3);
+    EXPECT_TRUE(graph.has_edge(0, 2));
+    EXPECT_FALSE(graph.has_edge(1, 2));
+
+    CompressedGraphBuilder graph_builder_2;
+    EXPECT_THROW(graph_builder_2.add_vertex({-1}), std::invalid_argument);
+}
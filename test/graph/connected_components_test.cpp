@@ -0,0 +1,128 @@
+#include "optimizationtools/graph/connected_components.hpp"
+#include "optimizationtools/graph/traversal.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <thread>
+
+using namespace optimizationtools;
+
+namespace
+{
+
+/** Build a graph made of several random components with random ids. */
+AdjacencyListGraph random_decomposable_graph(
+        VertexId number_of_vertices,
+        EdgeId number_of_edges,
+        ComponentId number_of_components,
+        std::mt19937_64& generator)
+{
+    std::uniform_int_distribution<ComponentId> distribution_component(0, number_of_components - 1);
+    std::vector<std::vector<VertexId>> components_vertices(number_of_components);
+    AdjacencyListGraphBuilder graph_builder;
+    for (VertexId vertex_id = 0; vertex_id < number_of_vertices; ++vertex_id) {
+        graph_builder.add_vertex(vertex_id);
+        components_vertices[distribution_component(generator)].push_back(vertex_id);
+    }
+    for (EdgeId edge_id = 0; edge_id < number_of_edges; ++edge_id) {
+        const std::vector<VertexId>& component_vertices
+            = components_vertices[distribution_component(generator)];
+        if (component_vertices.size() < 2)
+            continue;
+        std::uniform_int_distribution<VertexPos> distribution_vertex(0, component_vertices.size() - 1);
+        VertexId vertex_1_id = component_vertices[distribution_vertex(generator)];
+        VertexId vertex_2_id = component_vertices[distribution_vertex(generator)];
+        graph_builder.add_edge(vertex_1_id, vertex_2_id);
+    }
+    return graph_builder.build(true, 4);
+}
+
+}
+
+TEST(ConnectedComponents, ConnectedComponents)
+{
+    std::mt19937_64 generator(0);
+    AdjacencyListGraph graph = random_decomposable_graph(3000, 3000, 20, generator);
+
+    // Compute the expected components with breadth first searches.
+    std::vector<ComponentId> expected_components(graph.number_of_vertices(), -1);
+    ComponentId number_of_components = 0;
+    for (VertexId vertex_id = 0; vertex_id < graph.number_of_vertices(); ++vertex_id) {
+        if (expected_components[vertex_id] != -1)
+            continue;
+        for (VertexId vertex_id_2: breadth_first_search(graph, vertex_id).order)
+            expected_components[vertex_id_2] = number_of_components;
+        number_of_components++;
+    }
+
+    for (int number_of_threads: {1, 2, 4, 8})
+        EXPECT_EQ(connected_components(graph, number_of_threads), expected_components);
+
+    EXPECT_EQ(graph.number_of_components(), number_of_components);
+    for (VertexId vertex_id = 0; vertex_id < graph.number_of_vertices(); ++vertex_id)
+        EXPECT_EQ(graph.component(vertex_id), expected_components[vertex_id]);
+}
+
+TEST(ConnectedComponents, ComponentSubgraphs)
+{
+    std::mt19937_64 generator(0);
+    AdjacencyListGraph graph = random_decomposable_graph(3000, 5000, 20, generator);
+    std::vector<std::vector<VertexId>> components_vertices = connected_components_vertices(graph);
+    ASSERT_EQ((ComponentId)components_vertices.size(), graph.number_of_components());
+
+    // Extract the subgraphs in parallel.
+    std::vector<EdgeId> components_number_of_edges(components_vertices.size());
+    std::vector<Weight> components_total_weights(components_vertices.size());
+    std::vector<std::thread> threads;
+    for (int thread_id = 0; thread_id < 4; ++thread_id) {
+        threads.push_back(std::thread(
+                    [&graph, &components_vertices, &components_number_of_edges,
+                     &components_total_weights, thread_id]()
+                    {
+                        for (ComponentId component_id = thread_id;
+                                component_id < (ComponentId)components_vertices.size();
+                                component_id += 4) {
+                            AdjacencyListGraph subgraph = connected_component_subgraph(
+                                    graph,
+                                    components_vertices[component_id]);
+                            components_number_of_edges[component_id] = subgraph.number_of_edges();
+                            components_total_weights[component_id] = subgraph.total_weight();
+                        }
+                    }));
+    }
+    for (std::thread& thread: threads)
+        thread.join();
+
+    EdgeId number_of_edges = 0;
+    Weight total_weight = 0;
+    for (ComponentId component_id = 0;
+            component_id < (ComponentId)components_vertices.size();
+            ++component_id) {
+        number_of_edges += components_number_of_edges[component_id];
+        total_weight += components_total_weights[component_id];
+    }
+    EXPECT_EQ(number_of_edges, graph.number_of_edges());
+    EXPECT_EQ(total_weight, graph.total_weight());
+}
+
+TEST(ConnectedComponents, ComponentSubgraphNotComponent)
+{
+    AdjacencyListGraphBuilder graph_builder;
+    for (VertexId vertex_id = 0; vertex_id < 3; ++vertex_id)
+        graph_builder.add_vertex();
+    graph_builder.add_edge(0, 1);
+    graph_builder.add_edge(1, 2);
+    AdjacencyListGraph graph = graph_builder.build();
+    EXPECT_EQ(connected_component_subgraph(graph, {0, 1, 2}).number_of_edges(), 2);
+    EXPECT_THROW(connected_component_subgraph(graph, {0, 1}), std::invalid_argument);
+}
+
+TEST(ConnectedComponents, NotComputed)
+{
+    AdjacencyListGraphBuilder graph_builder;
+    graph_builder.add_vertex();
+    AdjacencyListGraph graph = graph_builder.build();
+    EXPECT_EQ(graph.number_of_components(), -1);
+    EXPECT_THROW(connected_components_vertices(graph), std::invalid_argument);
+}
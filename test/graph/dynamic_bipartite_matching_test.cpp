@@ -0,0 +1,121 @@
+#include "optimizationtools/graph/dynamic_bipartite_matching.hpp"
+
+#include "optimizationtools/graph/bipartite_graph.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+using namespace optimizationtools;
+
+namespace
+{
+
+/** Check that a dynamic matching is a maximum matching of its graph. */
+void check(const DynamicBipartiteMatching& matching)
+{
+    const DynamicGraph& graph = matching.graph();
+    EdgeId matching_size = 0;
+    for (EdgeId edge_id = 0; edge_id < graph.number_of_edge_ids(); ++edge_id) {
+        if (!matching.is_matched(edge_id))
+            continue;
+        const DynamicGraph::Edge& edge = graph.edge(edge_id);
+        EXPECT_EQ(matching.matched_edge(edge.vertex_2_id), edge_id);
+        EXPECT_EQ(matching.mate(edge.vertex_1_id), edge.vertex_2_id);
+        matching_size++;
+    }
+    EXPECT_EQ(matching.matching_size(), matching_size);
+
+    std::vector<VertexId> original_vertex_ids;
+    AdjacencyListGraph static_graph = graph.compact(original_vertex_ids);
+    std::vector<uint8_t> vertices_sides(graph.number_of_vertices());
+    for (VertexId vertex_id = 0; vertex_id < graph.number_of_vertices(); ++vertex_id)
+        vertices_sides[vertex_id] = matching.side(vertex_id);
+    BipartiteGraph bipartite_graph(static_graph, vertices_sides);
+    EXPECT_EQ(matching.matching_size(), bipartite_graph.matching_size());
+}
+
+}
+
+TEST(DynamicBipartiteMatching, RandomUpdates)
+{
+    std::mt19937_64 generator(0);
+    VertexId number_of_vertices = 60;
+    std::bernoulli_distribution distribution(0.04);
+    AdjacencyListGraphBuilder graph_builder;
+    for (VertexId vertex_id = 0; vertex_id < number_of_vertices; ++vertex_id)
+        graph_builder.add_vertex();
+    for (VertexId vertex_1_id = 0; vertex_1_id < number_of_vertices; vertex_1_id += 2)
+        for (VertexId vertex_2_id = 1; vertex_2_id < number_of_vertices; vertex_2_id += 2)
+            if (distribution(generator))
+                graph_builder.add_edge(vertex_1_id, vertex_2_id);
+    AdjacencyListGraph graph = graph_builder.build();
+
+    std::vector<uint8_t> vertices_sides(number_of_vertices);
+    for (VertexId vertex_id = 0; vertex_id < number_of_vertices; ++vertex_id)
+        vertices_sides[vertex_id] = vertex_id % 2;
+    DynamicBipartiteMatching matching(graph, vertices_sides);
+    EXPECT_EQ(matching.maximum_matching(), bipartite_graph_maximum_matching(graph, vertices_sides));
+    check(matching);
+
+    std::uniform_int_distribution<VertexId> distribution_vertex(0, number_of_vertices / 2 - 1);
+    std::bernoulli_distribution distribution_add(0.6);
+    for (int update = 0; update < 2000; ++update) {
+        const DynamicGraph& dynamic_graph = matching.graph();
+        if (dynamic_graph.number_of_edges() == 0 || distribution_add(generator)) {
+            VertexId vertex_1_id = 2 * distribution_vertex(generator);
+            VertexId vertex_2_id = 2 * distribution_vertex(generator) + 1;
+            matching.add_edge(vertex_1_id, vertex_2_id);
+        } else {
+            std::uniform_int_distribution<EdgeId> distribution_edge(
+                    0, dynamic_graph.number_of_edge_ids() - 1);
+            EdgeId edge_id = distribution_edge(generator);
+            while (!dynamic_graph.contains_edge(edge_id))
+                edge_id = distribution_edge(generator);
+            matching.remove_edge(edge_id);
+        }
+        check(matching);
+    }
+}
+
+TEST(DynamicBipartiteMatching, BothEndsMatched)
+{
+    // Paths 0 - 1 - 2 and 3 - 4 - 5, matched with {1, 2} and {3, 4}. The
+    // edge 2 - 3 creates the augmenting path 0 - 1 - 2 - 3 - 4 - 5.
+    DynamicBipartiteMatching matching({0, 1, 0, 1, 0, 1});
+    matching.add_edge(1, 2);
+    matching.add_edge(3, 4);
+    EdgeId edge_0_1_id = matching.add_edge(0, 1);
+    EdgeId edge_4_5_id = matching.add_edge(4, 5);
+    EXPECT_EQ(matching.matching_size(), 2);
+    EdgeId edge_2_3_id = matching.add_edge(2, 3);
+    EXPECT_EQ(matching.matching_size(), 3);
+    EXPECT_TRUE(matching.is_matched(edge_0_1_id));
+    EXPECT_TRUE(matching.is_matched(edge_2_3_id));
+    EXPECT_TRUE(matching.is_matched(edge_4_5_id));
+    check(matching);
+
+    // Removing the edge 2 - 3 frees 2 and 3; the matching goes back to two
+    // edges.
+    matching.remove_edge(edge_2_3_id);
+    EXPECT_EQ(matching.matching_size(), 2);
+    check(matching);
+}
+
+TEST(DynamicBipartiteMatching, NotBipartite)
+{
+    DynamicBipartiteMatching matching({0, 1, 0});
+    EXPECT_THROW(matching.add_edge(0, 2), std::invalid_argument);
+
+    AdjacencyListGraphBuilder graph_builder;
+    for (VertexId vertex_id = 0; vertex_id < 3; ++vertex_id)
+        graph_builder.add_vertex();
+    graph_builder.add_edge(0, 1);
+    graph_builder.add_edge(1, 2);
+    graph_builder.add_edge(2, 0);
+    AdjacencyListGraph graph = graph_builder.build();
+    EXPECT_THROW(DynamicBipartiteMatching matching_2(graph), std::invalid_argument);
+    EXPECT_THROW(
+            DynamicBipartiteMatching matching_3(graph, {0, 1, 0}),
+            std::invalid_argument);
+}
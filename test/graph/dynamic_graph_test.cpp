@@ -0,0 +1,113 @@
+#include "optimizationtools/graph/dynamic_graph.hpp"
+
+#include "random_graph.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <algorithm>
+
+using namespace optimizationtools;
+
+namespace
+{
+
+/** Check the back-pointers and the degrees of a dynamic graph. */
+void check(const DynamicGraph& graph)
+{
+    EdgeId number_of_edges = 0;
+    for (EdgeId edge_id = 0; edge_id < graph.number_of_edge_ids(); ++edge_id) {
+        if (!graph.contains_edge(edge_id))
+            continue;
+        number_of_edges++;
+        const DynamicGraph::Edge& edge = graph.edge(edge_id);
+        EXPECT_TRUE(graph.contains(edge.vertex_1_id));
+        EXPECT_TRUE(graph.contains(edge.vertex_2_id));
+        EXPECT_EQ(graph.edges(edge.vertex_1_id)[edge.vertex_1_position].edge_id, edge_id);
+        EXPECT_EQ(graph.edges(edge.vertex_1_id)[edge.vertex_1_position].vertex_id, edge.vertex_2_id);
+        EXPECT_EQ(graph.edges(edge.vertex_2_id)[edge.vertex_2_position].edge_id, edge_id);
+        EXPECT_EQ(graph.edges(edge.vertex_2_id)[edge.vertex_2_position].vertex_id, edge.vertex_1_id);
+    }
+    EXPECT_EQ(graph.number_of_edges(), number_of_edges);
+
+    EdgeId sum_of_degrees = 0;
+    Weight total_weight = 0;
+    for (VertexId vertex_id = 0; vertex_id < graph.number_of_vertices(); ++vertex_id) {
+        sum_of_degrees += graph.degree(vertex_id);
+        if (graph.contains(vertex_id)) {
+            total_weight += graph.weight(vertex_id);
+        } else {
+            EXPECT_EQ(graph.degree(vertex_id), 0);
+        }
+    }
+    EXPECT_EQ(sum_of_degrees, 2 * number_of_edges);
+    EXPECT_EQ(graph.total_weight(), total_weight);
+}
+
+}
+
+TEST(DynamicGraph, RemoveEdgesAndVertices)
+{
+    std::mt19937_64 generator(0);
+    AdjacencyListGraph graph = random_graph(
+            100,
+            0.2,
+            generator,
+            RandomGraphWeights::Id);
+    DynamicGraph dynamic_graph(graph);
+    EXPECT_EQ(dynamic_graph.number_of_edges(), graph.number_of_edges());
+    check(dynamic_graph);
+
+    std::uniform_int_distribution<EdgeId> distribution_edge(0, graph.number_of_edges() - 1);
+    std::uniform_int_distribution<VertexId> distribution_vertex(0, graph.number_of_vertices() - 1);
+    for (Counter iteration = 0; iteration < 300; ++iteration) {
+        if (iteration % 3 == 0) {
+            dynamic_graph.remove_vertex(distribution_vertex(generator));
+        } else if (iteration % 3 == 1) {
+            dynamic_graph.remove_edge(distribution_edge(generator));
+        } else {
+            VertexId vertex_1_id = distribution_vertex(generator);
+            VertexId vertex_2_id = distribution_vertex(generator);
+            if (dynamic_graph.contains(vertex_1_id)
+                    && dynamic_graph.contains(vertex_2_id)) {
+                EdgeId edge_id = dynamic_graph.add_edge(vertex_1_id, vertex_2_id);
+                if (vertex_1_id != vertex_2_id) {
+                    EXPECT_TRUE(dynamic_graph.has_edge(vertex_1_id, vertex_2_id));
+                    EXPECT_EQ(dynamic_graph.other_end(edge_id, vertex_1_id), vertex_2_id);
+                }
+            }
+        }
+    }
+    check(dynamic_graph);
+}
+
+TEST(DynamicGraph, Compact)
+{
+    std::mt19937_64 generator(0);
+    AdjacencyListGraph graph = random_graph(
+            50,
+            0.3,
+            generator,
+            RandomGraphWeights::Id);
+    DynamicGraph dynamic_graph(graph);
+    dynamic_graph.remove_vertex(3);
+    dynamic_graph.remove_vertex(10);
+    dynamic_graph.remove_edge(dynamic_graph.edges(0)[0].edge_id);
+    dynamic_graph.set_weight(1, 100);
+
+    std::vector<VertexId> original_vertex_ids;
+    AdjacencyListGraph compact_graph = dynamic_graph.compact(original_vertex_ids);
+    ASSERT_EQ(compact_graph.number_of_vertices(), 48);
+    EXPECT_EQ(compact_graph.number_of_edges(), dynamic_graph.number_of_edges());
+    EXPECT_EQ(compact_graph.total_weight(), dynamic_graph.total_weight());
+    for (VertexId vertex_id = 0; vertex_id < compact_graph.number_of_vertices(); ++vertex_id) {
+        VertexId original_vertex_id = original_vertex_ids[vertex_id];
+        EXPECT_EQ(compact_graph.degree(vertex_id), dynamic_graph.degree(original_vertex_id));
+        EXPECT_EQ(compact_graph.weight(vertex_id), dynamic_graph.weight(original_vertex_id));
+        for (VertexId neighbor_id: compact_graph.vertex(vertex_id).neighbors) {
+            EXPECT_TRUE(dynamic_graph.has_edge(
+                        original_vertex_id,
+                        original_vertex_ids[neighbor_id]));
+        }
+    }
+}
@@ -0,0 +1,133 @@
+#include "optimizationtools/graph/k_core.hpp"
+
+#include "random_graph.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <algorithm>
+
+using namespace optimizationtools;
+
+namespace
+{
+
+/** Compute the core numbers by removing the vertices of the k-cores. */
+std::vector<VertexPos> core_numbers_naive(
+        const AdjacencyListGraph& graph)
+{
+    VertexId number_of_vertices = graph.number_of_vertices();
+    std::vector<VertexPos> core_numbers(number_of_vertices, 0);
+    std::vector<bool> removed(number_of_vertices, false);
+    for (VertexPos k = 1;; ++k) {
+        // Remove the vertices of degree smaller than k until there are none.
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            for (VertexId vertex_id = 0; vertex_id < number_of_vertices; ++vertex_id) {
+                if (removed[vertex_id])
+                    continue;
+                VertexPos degree = 0;
+                for (VertexId neighbor_id: graph.vertex(vertex_id).neighbors)
+                    if (!removed[neighbor_id])
+                        degree++;
+                if (degree < k) {
+                    removed[vertex_id] = true;
+                    changed = true;
+                }
+            }
+        }
+        bool empty = true;
+        for (VertexId vertex_id = 0; vertex_id < number_of_vertices; ++vertex_id) {
+            if (!removed[vertex_id]) {
+                core_numbers[vertex_id] = k;
+                empty = false;
+            }
+        }
+        if (empty)
+            break;
+    }
+    return core_numbers;
+}
+
+void check(
+        const AdjacencyListGraph& graph,
+        const CoreDecomposition& core_decomposition)
+{
+    std::vector<VertexPos> core_numbers = core_numbers_naive(graph);
+    EXPECT_EQ(core_decomposition.core_numbers, core_numbers);
+    EXPECT_EQ(
+            core_decomposition.degeneracy,
+            *std::max_element(core_numbers.begin(), core_numbers.end()));
+
+    // Each vertex has at most its core number neighbors after it.
+    ASSERT_EQ((VertexId)core_decomposition.ordering.size(), graph.number_of_vertices());
+    std::vector<VertexPos> positions(graph.number_of_vertices(), -1);
+    for (VertexPos pos = 0; pos < graph.number_of_vertices(); ++pos)
+        positions[core_decomposition.ordering[pos]] = pos;
+    for (VertexId vertex_id = 0; vertex_id < graph.number_of_vertices(); ++vertex_id) {
+        ASSERT_NE(positions[vertex_id], -1);
+        VertexPos number_of_later_neighbors = 0;
+        for (VertexId neighbor_id: graph.vertex(vertex_id).neighbors)
+            if (positions[neighbor_id] > positions[vertex_id])
+                number_of_later_neighbors++;
+        EXPECT_LE(number_of_later_neighbors, core_numbers[vertex_id]);
+    }
+}
+
+}
+
+TEST(KCore, CoreDecomposition)
+{
+    std::mt19937_64 generator(0);
+    for (EdgeId number_of_edges: {0, 100, 1000, 5000}) {
+        AdjacencyListGraph graph = random_graph_with_number_of_edges(
+                200,
+                number_of_edges,
+                generator,
+                RandomGraphWeights::Unit,
+                true);
+        check(graph, core_decomposition(graph));
+    }
+}
+
+TEST(KCore, CoreDecompositionParallel)
+{
+    std::mt19937_64 generator(0);
+    for (EdgeId number_of_edges: {0, 100, 1000, 5000}) {
+        AdjacencyListGraph graph = random_graph_with_number_of_edges(
+                200,
+                number_of_edges,
+                generator,
+                RandomGraphWeights::Unit,
+                true);
+        CoreDecomposition core_decomposition_1 = core_decomposition(graph, 2);
+        check(graph, core_decomposition_1);
+        CoreDecomposition core_decomposition_2 = core_decomposition(graph, 3);
+        EXPECT_EQ(core_decomposition_1.ordering, core_decomposition_2.ordering);
+    }
+}
+
+TEST(KCore, KCoreVertices)
+{
+    std::mt19937_64 generator(0);
+    AdjacencyListGraph graph = random_graph_with_number_of_edges(
+            200,
+            1500,
+            generator,
+            RandomGraphWeights::Unit,
+            true);
+    CoreDecomposition decomposition = core_decomposition(graph);
+    for (VertexPos k = 0; k <= decomposition.degeneracy + 1; ++k) {
+        std::vector<VertexId> vertices = k_core_vertices(decomposition, k);
+        EXPECT_TRUE(std::is_sorted(vertices.begin(), vertices.end()));
+        for (VertexId vertex_id: vertices) {
+            VertexPos degree = 0;
+            for (VertexId neighbor_id: graph.vertex(vertex_id).neighbors)
+                if (std::binary_search(vertices.begin(), vertices.end(), neighbor_id))
+                    degree++;
+            EXPECT_GE(degree, k);
+        }
+    }
+    EXPECT_TRUE(k_core_vertices(decomposition, decomposition.degeneracy + 1).empty());
+}
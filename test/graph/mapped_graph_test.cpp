@@ -0,0 +1,164 @@
+#include "optimizationtools/graph/mapped_graph.hpp"
+#include "optimizationtools/graph/adjacency_list_graph.hpp"
+
+#include "random_graph.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <algorithm>
+#include <memory>
+#include <fstream>
+#include <cstdint>
+
+using namespace optimizationtools;
+
+namespace
+{
+
+void check(
+        const AdjacencyListGraph& graph,
+        const MappedGraph& mapped_graph)
+{
+    ASSERT_EQ(mapped_graph.number_of_vertices(), graph.number_of_vertices());
+    EXPECT_EQ(mapped_graph.number_of_edges(), graph.number_of_edges());
+    EXPECT_EQ(mapped_graph.highest_degree(), graph.highest_degree());
+    EXPECT_EQ(mapped_graph.total_weight(), graph.total_weight());
+    std::vector<VertexId> neighbors_tmp;
+    for (VertexId vertex_id = 0; vertex_id < graph.number_of_vertices(); ++vertex_id) {
+        EXPECT_EQ(mapped_graph.weight(vertex_id), graph.weight(vertex_id));
+        std::vector<VertexId> neighbors = graph.vertex(vertex_id).neighbors;
+        std::sort(neighbors.begin(), neighbors.end());
+        EXPECT_EQ(mapped_graph.neighbors(vertex_id, neighbors_tmp), neighbors);
+        std::vector<VertexId> neighbors_2;
+        mapped_graph.for_each_neighbor(
+                vertex_id,
+                [&neighbors_2](VertexId neighbor_id) { neighbors_2.push_back(neighbor_id); });
+        EXPECT_EQ(neighbors_2, neighbors);
+    }
+}
+
+}
+
+TEST(MappedGraph, ExternalMemoryBuild)
+{
+    std::mt19937_64 generator(0);
+    AdjacencyListGraph graph = random_graph_with_number_of_edges(
+            300,
+            3000,
+            generator,
+            RandomGraphWeights::Random);
+    std::string instance_path = testing::TempDir() + "mapped_graph_instance";
+    std::string graph_path = testing::TempDir() + "mapped_graph";
+    graph.write(instance_path, "binary");
+
+    // A small buffer so that the edges are split into many runs, merged in
+    // several passes.
+    ExternalMemoryGraphBuilder graph_builder(testing::TempDir() + "mapped_graph_", 128, 4);
+    graph_builder.read(instance_path, "binary");
+    MappedGraph mapped_graph = graph_builder.build(graph_path);
+    EXPECT_TRUE(mapped_graph.is_mapped());
+    check(graph, mapped_graph);
+
+    std::unique_ptr<AbstractGraph> mapped_graph_clone(mapped_graph.clone());
+    EXPECT_EQ(mapped_graph_clone->number_of_edges(), graph.number_of_edges());
+}
+
+TEST(MappedGraph, RemoveDuplicateEdges)
+{
+    std::mt19937_64 generator(0);
+    AdjacencyListGraph graph = random_graph_with_number_of_edges(
+            50,
+            3000,
+            generator,
+            RandomGraphWeights::Random);
+    std::string instance_path = testing::TempDir() + "mapped_graph_instance";
+    std::string graph_path = testing::TempDir() + "mapped_graph";
+    graph.write(instance_path, "binary");
+
+    ExternalMemoryGraphBuilder graph_builder(testing::TempDir() + "mapped_graph_", 100, 3);
+    graph_builder.read(instance_path, "binary");
+    MappedGraph mapped_graph = graph_builder.build(graph_path, true);
+
+    AdjacencyListGraphBuilder graph_builder_2;
+    graph_builder_2.read(instance_path, "binary");
+    graph_builder_2.remove_duplicate_edges();
+    check(graph_builder_2.build(), mapped_graph);
+}
+
+TEST(MappedGraph, InvalidFile)
+{
+    std::string instance_path = testing::TempDir() + "mapped_graph_instance";
+    AdjacencyListGraphBuilder graph_builder;
+    graph_builder.add_vertex();
+    graph_builder.build().write(instance_path, "binary");
+    EXPECT_THROW(MappedGraph graph(instance_path), std::runtime_error);
+}
+
+TEST(MappedGraph, CorruptHeader)
+{
+    std::mt19937_64 generator(0);
+    AdjacencyListGraph graph = random_graph_with_number_of_edges(
+            20,
+            50,
+            generator,
+            RandomGraphWeights::Random);
+    std::string instance_path = testing::TempDir() + "mapped_graph_instance";
+    std::string graph_path = testing::TempDir() + "mapped_graph";
+    graph.write(instance_path, "binary");
+    ExternalMemoryGraphBuilder graph_builder(testing::TempDir() + "mapped_graph_");
+    graph_builder.read(instance_path, "binary");
+    graph_builder.build(graph_path);
+
+    // Overwrite the number of vertices, then the number of arcs, with
+    // negative or overflowing values.
+    for (std::streamoff position: {8, 16}) {
+        for (int64_t value: {(int64_t)-1, (int64_t)1 << 62, INT64_MAX}) {
+            std::string corrupt_graph_path = testing::TempDir() + "mapped_graph_corrupt";
+            {
+                std::ifstream file(graph_path, std::ios::in | std::ios::binary);
+                std::ofstream corrupt_file(corrupt_graph_path, std::ios::out | std::ios::binary);
+                corrupt_file << file.rdbuf();
+                corrupt_file.seekp(position);
+                corrupt_file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+            }
+            EXPECT_THROW(MappedGraph corrupt_graph(corrupt_graph_path), std::runtime_error);
+        }
+    }
+}
+
+TEST(MappedGraph, InvalidEdge)
+{
+    ExternalMemoryGraphBuilder graph_builder(testing::TempDir() + "mapped_graph_");
+    graph_builder.add_vertex();
+    graph_builder.add_vertex();
+    EXPECT_EQ(graph_builder.add_edge(0, 1), 0);
+    EXPECT_THROW(graph_builder.add_edge(0, 2), std::invalid_argument);
+    EXPECT_THROW(graph_builder.add_edge(-1, 1), std::invalid_argument);
+}
+
+TEST(MappedGraph, CorruptNeighbors)
+{
+    std::string graph_path = testing::TempDir() + "mapped_graph";
+    ExternalMemoryGraphBuilder graph_builder(testing::TempDir() + "mapped_graph_");
+    for (VertexId vertex_id = 0; vertex_id < 3; ++vertex_id)
+        graph_builder.add_vertex();
+    graph_builder.add_edge(0, 1);
+    graph_builder.add_edge(1, 2);
+    graph_builder.build(graph_path);
+
+    // Overwrite the last neighbor, after the header, the 3 weights and the 4
+    // offsets, with a negative or too large vertex id.
+    std::streamoff position = 8 + 8 * (2 + 3 + 4 + 3);
+    for (int64_t value: {(int64_t)-1, (int64_t)3}) {
+        std::string corrupt_graph_path = testing::TempDir() + "mapped_graph_corrupt";
+        {
+            std::ifstream file(graph_path, std::ios::in | std::ios::binary);
+            std::ofstream corrupt_file(corrupt_graph_path, std::ios::out | std::ios::binary);
+            corrupt_file << file.rdbuf();
+            corrupt_file.seekp(position);
+            corrupt_file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+        }
+        EXPECT_THROW(MappedGraph corrupt_graph(corrupt_graph_path), std::runtime_error);
+    }
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "optimizationtools/graph/adjacency_list_graph.hpp"
+
+#include <random>
+
+namespace optimizationtools
+{
+
+/**
+ * Weights of the vertices of the random graphs of the tests.
+ */
+enum class RandomGraphWeights
+{
+    /** All the weights are 1. */
+    Unit,
+
+    /** The weight of vertex 'v' is 'v + 1'. */
+    Id,
+
+    /** The weights are drawn uniformly in [1, 10]. */
+    Random,
+};
+
+/** Add the vertices of a random graph to a builder. */
+inline void random_graph_add_vertices(
+        AdjacencyListGraphBuilder& graph_builder,
+        VertexId number_of_vertices,
+        RandomGraphWeights weights,
+        std::mt19937_64& generator)
+{
+    std::uniform_int_distribution<int> distribution_weight(1, 10);
+    for (VertexId vertex_id = 0; vertex_id < number_of_vertices; ++vertex_id) {
+        switch (weights) {
+        case RandomGraphWeights::Unit: {
+            graph_builder.add_vertex();
+            break;
+        } case RandomGraphWeights::Id: {
+            graph_builder.add_vertex(vertex_id + 1);
+            break;
+        } case RandomGraphWeights::Random: {
+            graph_builder.add_vertex(distribution_weight(generator));
+            break;
+        }
+        }
+    }
+}
+
+/**
+ * Generate a random graph in which each pair of vertices is adjacent with
+ * probability 'density'.
+ */
+inline AdjacencyListGraph random_graph(
+        VertexId number_of_vertices,
+        double density,
+        std::mt19937_64& generator,
+        RandomGraphWeights weights = RandomGraphWeights::Unit)
+{
+    AdjacencyListGraphBuilder graph_builder;
+    random_graph_add_vertices(graph_builder, number_of_vertices, weights, generator);
+    std::bernoulli_distribution distribution(density);
+    for (VertexId vertex_1_id = 0; vertex_1_id < number_of_vertices; ++vertex_1_id)
+        for (VertexId vertex_2_id = vertex_1_id + 1; vertex_2_id < number_of_vertices; ++vertex_2_id)
+            if (distribution(generator))
+                graph_builder.add_edge(vertex_1_id, vertex_2_id);
+    return graph_builder.build();
+}
+
+/**
+ * Generate a random graph with 'number_of_edges' edges whose ends are drawn
+ * uniformly.
+ *
+ * The self-loops are skipped by the builder; the parallel edges are kept
+ * unless 'remove_duplicate_edges' is 'true'.
+ */
+inline AdjacencyListGraph random_graph_with_number_of_edges(
+        VertexId number_of_vertices,
+        EdgeId number_of_edges,
+        std::mt19937_64& generator,
+        RandomGraphWeights weights = RandomGraphWeights::Unit,
+        bool remove_duplicate_edges = false)
+{
+    AdjacencyListGraphBuilder graph_builder;
+    random_graph_add_vertices(graph_builder, number_of_vertices, weights, generator);
+    std::uniform_int_distribution<VertexId> distribution(0, number_of_vertices - 1);
+    for (EdgeId edge_id = 0; edge_id < number_of_edges; ++edge_id)
+        graph_builder.add_edge(distribution(generator), distribution(generator));
+    if (remove_duplicate_edges)
+        graph_builder.remove_duplicate_edges();
+    return graph_builder.build();
+}
+
+}
@@ -0,0 +1,145 @@
+#include "optimizationtools/graph/reordering.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <algorithm>
+#include <numeric>
+
+using namespace optimizationtools;
+
+namespace
+{
+
+/** Build a grid graph whose vertices are numbered randomly. */
+AdjacencyListGraph shuffled_grid_graph(
+        VertexId number_of_rows,
+        VertexId number_of_columns,
+        std::mt19937_64& generator)
+{
+    VertexId number_of_vertices = number_of_rows * number_of_columns;
+    std::vector<VertexId> vertex_ids(number_of_vertices);
+    std::iota(vertex_ids.begin(), vertex_ids.end(), 0);
+    std::shuffle(vertex_ids.begin(), vertex_ids.end(), generator);
+
+    AdjacencyListGraphBuilder graph_builder;
+    for (VertexId vertex_id = 0; vertex_id < number_of_vertices; ++vertex_id)
+        graph_builder.add_vertex(vertex_id);
+    for (VertexId row = 0; row < number_of_rows; ++row) {
+        for (VertexId column = 0; column < number_of_columns; ++column) {
+            VertexId vertex_id = vertex_ids[row * number_of_columns + column];
+            if (row + 1 < number_of_rows)
+                graph_builder.add_edge(vertex_id, vertex_ids[(row + 1) * number_of_columns + column]);
+            if (column + 1 < number_of_columns)
+                graph_builder.add_edge(vertex_id, vertex_ids[row * number_of_columns + column + 1]);
+        }
+    }
+    return graph_builder.build();
+}
+
+VertexPos bandwidth(const AdjacencyListGraph& graph)
+{
+    VertexPos bandwidth = 0;
+    for (EdgeId edge_id = 0; edge_id < graph.number_of_edges(); ++edge_id) {
+        bandwidth = (std::max)(
+                bandwidth,
+                std::abs(graph.first_end(edge_id) - graph.second_end(edge_id)));
+    }
+    return bandwidth;
+}
+
+std::vector<std::pair<VertexId, VertexId>> sorted_edges(
+        const AdjacencyListGraph& graph)
+{
+    std::vector<std::pair<VertexId, VertexId>> edges;
+    for (EdgeId edge_id = 0; edge_id < graph.number_of_edges(); ++edge_id) {
+        VertexId vertex_1_id = graph.first_end(edge_id);
+        VertexId vertex_2_id = graph.second_end(edge_id);
+        edges.push_back({(std::min)(vertex_1_id, vertex_2_id), (std::max)(vertex_1_id, vertex_2_id)});
+    }
+    std::sort(edges.begin(), edges.end());
+    return edges;
+}
+
+}
+
+TEST(Reordering, Orderings)
+{
+    std::mt19937_64 generator(0);
+    AdjacencyListGraph graph = shuffled_grid_graph(20, 30, generator);
+
+    for (VertexOrdering ordering: {
+            VertexOrdering::ReverseCuthillMcKee,
+            VertexOrdering::DegreeDescending,
+            VertexOrdering::Degeneracy,
+            VertexOrdering::Gorder}) {
+        VertexReordering reordering = compute_vertex_reordering(graph, ordering);
+        AdjacencyListGraph reordered_graph = reorder(graph, reordering);
+        ASSERT_EQ(reordered_graph.number_of_vertices(), graph.number_of_vertices());
+        ASSERT_EQ(reordered_graph.number_of_edges(), graph.number_of_edges());
+
+        // Weights and edges are preserved.
+        for (VertexId vertex_id = 0; vertex_id < graph.number_of_vertices(); ++vertex_id) {
+            EXPECT_EQ(reordering.new_vertex_ids[reordering.original_vertex_ids[vertex_id]], vertex_id);
+            EXPECT_EQ(reordered_graph.weight(vertex_id), graph.weight(reordering.original_vertex_ids[vertex_id]));
+        }
+        AdjacencyListGraphBuilder graph_builder;
+        for (VertexId vertex_id = 0; vertex_id < graph.number_of_vertices(); ++vertex_id)
+            graph_builder.add_vertex();
+        for (EdgeId edge_id = 0; edge_id < reordered_graph.number_of_edges(); ++edge_id) {
+            graph_builder.add_edge(
+                    reordering.original_vertex_ids[reordered_graph.first_end(edge_id)],
+                    reordering.original_vertex_ids[reordered_graph.second_end(edge_id)]);
+        }
+        EXPECT_EQ(sorted_edges(graph_builder.build()), sorted_edges(graph));
+
+        // Neighbors are sorted.
+        for (VertexId vertex_id = 0; vertex_id < graph.number_of_vertices(); ++vertex_id) {
+            EXPECT_TRUE(std::is_sorted(
+                        reordered_graph.neighbors_begin(vertex_id),
+                        reordered_graph.neighbors_end(vertex_id)));
+        }
+    }
+}
+
+TEST(Reordering, ReverseCuthillMcKeeBandwidth)
+{
+    std::mt19937_64 generator(0);
+    AdjacencyListGraph graph = shuffled_grid_graph(20, 30, generator);
+    VertexReordering reordering = compute_vertex_reordering(
+            graph,
+            VertexOrdering::ReverseCuthillMcKee);
+    AdjacencyListGraph reordered_graph = reorder(graph, reordering);
+    // The bandwidth of a 20x30 grid numbered by diagonals is at most 2 * 20.
+    EXPECT_LE(bandwidth(reordered_graph), 40);
+    EXPECT_GT(bandwidth(graph), 40);
+}
+
+TEST(Reordering, Degeneracy)
+{
+    // A triangle with a pendant vertex: the pendant vertex is removed first.
+    AdjacencyListGraphBuilder graph_builder;
+    for (VertexId vertex_id = 0; vertex_id < 4; ++vertex_id)
+        graph_builder.add_vertex();
+    graph_builder.add_edge(0, 1);
+    graph_builder.add_edge(1, 2);
+    graph_builder.add_edge(2, 0);
+    graph_builder.add_edge(2, 3);
+    AdjacencyListGraph graph = graph_builder.build();
+    VertexReordering reordering = compute_vertex_reordering(
+            graph,
+            VertexOrdering::Degeneracy);
+    EXPECT_EQ(reordering.original_vertex_ids[0], 3);
+}
+
+TEST(Reordering, ToOriginal)
+{
+    VertexReordering reordering = vertex_reordering({2, 0, 1});
+    std::vector<VertexId> expected_vertex_ids = {2, 1};
+    EXPECT_EQ(to_original_vertex_ids(reordering, {0, 2}), expected_vertex_ids);
+    std::vector<std::vector<VertexId>> expected_cliques = {{2}, {0, 1}};
+    EXPECT_EQ(to_original_vertex_ids(reordering, {{0}, {1, 2}}), expected_cliques);
+    std::vector<int> expected_values = {20, 30, 10};
+    EXPECT_EQ(to_original_vertex_values(reordering, std::vector<int>{10, 20, 30}), expected_values);
+    EXPECT_THROW(vertex_reordering({0, 0, 1}), std::invalid_argument);
+}
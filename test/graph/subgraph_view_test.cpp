@@ -0,0 +1,90 @@
+#include "optimizationtools/graph/subgraph_view.hpp"
+
+#include "random_graph.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <algorithm>
+
+using namespace optimizationtools;
+
+namespace
+{
+
+/** Check the view against the subgraph built from scratch. */
+void check(const SubgraphView& subgraph)
+{
+    std::vector<VertexId> original_vertex_ids;
+    AdjacencyListGraph graph = subgraph.build_graph(original_vertex_ids);
+    ASSERT_EQ(graph.number_of_vertices(), subgraph.number_of_vertices());
+    EXPECT_EQ(graph.number_of_edges(), subgraph.number_of_edges());
+    EXPECT_EQ(graph.total_weight(), subgraph.total_weight());
+    for (VertexId vertex_id = 0; vertex_id < graph.number_of_vertices(); ++vertex_id) {
+        VertexId original_vertex_id = original_vertex_ids[vertex_id];
+        EXPECT_TRUE(subgraph.contains(original_vertex_id));
+        EXPECT_EQ(graph.degree(vertex_id), subgraph.degree(original_vertex_id));
+
+        std::vector<VertexId> neighbors;
+        for (VertexId neighbor_id: graph.vertex(vertex_id).neighbors)
+            neighbors.push_back(original_vertex_ids[neighbor_id]);
+        std::sort(neighbors.begin(), neighbors.end());
+        std::vector<VertexId> subgraph_neighbors;
+        subgraph.for_each_neighbor(
+                original_vertex_id,
+                [&subgraph_neighbors](VertexId neighbor_id) { subgraph_neighbors.push_back(neighbor_id); });
+        std::sort(subgraph_neighbors.begin(), subgraph_neighbors.end());
+        EXPECT_EQ(subgraph_neighbors, neighbors);
+    }
+}
+
+}
+
+TEST(SubgraphView, AddRemoveVertices)
+{
+    std::mt19937_64 generator(0);
+    AdjacencyListGraph graph = random_graph(
+            100,
+            0.2,
+            generator,
+            RandomGraphWeights::Id);
+
+    SubgraphView subgraph(graph);
+    EXPECT_EQ(subgraph.number_of_vertices(), graph.number_of_vertices());
+    EXPECT_EQ(subgraph.number_of_edges(), graph.number_of_edges());
+    check(subgraph);
+
+    std::uniform_int_distribution<VertexId> distribution(0, graph.number_of_vertices() - 1);
+    for (Counter iteration = 0; iteration < 60; ++iteration) {
+        subgraph.remove_vertex(distribution(generator));
+        if (iteration % 10 == 0)
+            subgraph.materialize();
+        check(subgraph);
+    }
+    EXPECT_TRUE(subgraph.is_materialized());
+    for (Counter iteration = 0; iteration < 20; ++iteration) {
+        VertexId vertex_id = distribution(generator);
+        bool is_active = subgraph.contains(vertex_id);
+        subgraph.add_vertex(vertex_id);
+        if (!is_active) {
+            EXPECT_FALSE(subgraph.is_materialized());
+        }
+        check(subgraph);
+    }
+}
+
+TEST(SubgraphView, VertexSubset)
+{
+    std::mt19937_64 generator(0);
+    AdjacencyListGraph graph = random_graph(
+            100,
+            0.2,
+            generator,
+            RandomGraphWeights::Id);
+
+    SubgraphView subgraph(graph, {5, 3, 17, 42, 43, 44, 99, 3});
+    EXPECT_EQ(subgraph.number_of_vertices(), 7);
+    check(subgraph);
+    subgraph.materialize();
+    check(subgraph);
+}
@@ -0,0 +1,109 @@
+#include "optimizationtools/graph/traversal.hpp"
+#include "optimizationtools/graph/adjacency_list_graph.hpp"
+#include "optimizationtools/graph/clique_graph.hpp"
+#include "optimizationtools/graph/bipartite_graph.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+using namespace optimizationtools;
+
+namespace
+{
+
+/** Build a graph and the same graph as a clique graph with one clique per edge. */
+void random_graphs(
+        VertexId number_of_vertices,
+        double density,
+        std::mt19937_64& generator,
+        AdjacencyListGraphBuilder& graph_builder,
+        CliqueGraphBuilder& clique_graph_builder)
+{
+    for (VertexId vertex_id = 0; vertex_id < number_of_vertices; ++vertex_id) {
+        graph_builder.add_vertex();
+        clique_graph_builder.add_vertex();
+    }
+    std::bernoulli_distribution distribution(density);
+    for (VertexId vertex_1_id = 0; vertex_1_id < number_of_vertices; ++vertex_1_id) {
+        for (VertexId vertex_2_id = vertex_1_id + 1; vertex_2_id < number_of_vertices; ++vertex_2_id) {
+            if (distribution(generator)) {
+                graph_builder.add_edge(vertex_1_id, vertex_2_id);
+                clique_graph_builder.add_clique({vertex_1_id, vertex_2_id});
+            }
+        }
+    }
+}
+
+}
+
+TEST(Traversal, BreadthFirstSearch)
+{
+    std::mt19937_64 generator(0);
+    AdjacencyListGraphBuilder graph_builder;
+    CliqueGraphBuilder clique_graph_builder;
+    random_graphs(200, 0.01, generator, graph_builder, clique_graph_builder);
+    AdjacencyListGraph graph = graph_builder.build();
+    CliqueGraph clique_graph = clique_graph_builder.build();
+    const AbstractGraph& abstract_graph = graph;
+
+    BreadthFirstSearchOutput output = breadth_first_search(graph, 0);
+    BreadthFirstSearchOutput output_abstract = breadth_first_search(abstract_graph, 0);
+    BreadthFirstSearchOutput output_clique = breadth_first_search(clique_graph, 0);
+    EXPECT_EQ(output.order, output_abstract.order);
+    EXPECT_EQ(output.distances, output_abstract.distances);
+    EXPECT_EQ(output.distances, output_clique.distances);
+
+    for (VertexId vertex_id = 0; vertex_id < graph.number_of_vertices(); ++vertex_id) {
+        VertexId parent_id = output.parents[vertex_id];
+        if (parent_id == -1)
+            continue;
+        EXPECT_EQ(output.distances[vertex_id], output.distances[parent_id] + 1);
+    }
+}
+
+TEST(Traversal, DepthFirstSearch)
+{
+    std::mt19937_64 generator(0);
+    AdjacencyListGraphBuilder graph_builder;
+    CliqueGraphBuilder clique_graph_builder;
+    random_graphs(200, 0.01, generator, graph_builder, clique_graph_builder);
+    AdjacencyListGraph graph = graph_builder.build();
+    CliqueGraph clique_graph = clique_graph_builder.build();
+
+    std::vector<VertexId> order = depth_first_search(graph, 0);
+    std::vector<VertexId> order_clique = depth_first_search(clique_graph, 0);
+    BreadthFirstSearchOutput output = breadth_first_search(graph, 0);
+    EXPECT_EQ(order.size(), output.order.size());
+    EXPECT_EQ(order.size(), order_clique.size());
+    EXPECT_EQ(order[0], 0);
+}
+
+TEST(Traversal, BipartiteGraphIdentify)
+{
+    // Even cycle: bipartite.
+    AdjacencyListGraphBuilder graph_builder;
+    CliqueGraphBuilder clique_graph_builder;
+    for (VertexId vertex_id = 0; vertex_id < 6; ++vertex_id) {
+        graph_builder.add_vertex();
+        clique_graph_builder.add_vertex();
+    }
+    for (VertexId vertex_id = 0; vertex_id < 6; ++vertex_id) {
+        graph_builder.add_edge(vertex_id, (vertex_id + 1) % 6);
+        clique_graph_builder.add_clique({vertex_id, (vertex_id + 1) % 6});
+    }
+    AdjacencyListGraph graph = graph_builder.build();
+    CliqueGraph clique_graph = clique_graph_builder.build();
+    std::vector<uint8_t> vertices_sides = bipartite_graph_identify(graph);
+    std::vector<uint8_t> expected_vertices_sides = {0, 1, 0, 1, 0, 1};
+    EXPECT_EQ(vertices_sides, expected_vertices_sides);
+    EXPECT_EQ(bipartite_graph_identify(clique_graph), expected_vertices_sides);
+
+    // Triangle: not bipartite.
+    CliqueGraphBuilder clique_graph_builder_2;
+    for (VertexId vertex_id = 0; vertex_id < 3; ++vertex_id)
+        clique_graph_builder_2.add_vertex();
+    clique_graph_builder_2.add_clique({0, 1, 2});
+    CliqueGraph clique_graph_2 = clique_graph_builder_2.build();
+    EXPECT_TRUE(bipartite_graph_identify(clique_graph_2).empty());
+}
@@ -0,0 +1,75 @@
+#include "optimizationtools/graph/triangles.hpp"
+
+#include "random_graph.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+using namespace optimizationtools;
+
+TEST(Triangles, CountTriangles)
+{
+    std::mt19937_64 generator(0);
+    VertexId number_of_vertices = 60;
+    AdjacencyListGraph graph = random_graph(number_of_vertices, 0.2, generator);
+    std::vector<std::vector<uint8_t>> adjacency_matrix(
+            number_of_vertices,
+            std::vector<uint8_t>(number_of_vertices, 0));
+    for (EdgeId edge_id = 0; edge_id < graph.number_of_edges(); ++edge_id) {
+        adjacency_matrix[graph.first_end(edge_id)][graph.second_end(edge_id)] = 1;
+        adjacency_matrix[graph.second_end(edge_id)][graph.first_end(edge_id)] = 1;
+    }
+
+    Counter expected_number_of_triangles = 0;
+    std::vector<Counter> expected_vertices_number_of_triangles(number_of_vertices, 0);
+    for (VertexId vertex_1_id = 0; vertex_1_id < number_of_vertices; ++vertex_1_id) {
+        for (VertexId vertex_2_id = vertex_1_id + 1; vertex_2_id < number_of_vertices; ++vertex_2_id) {
+            for (VertexId vertex_3_id = vertex_2_id + 1; vertex_3_id < number_of_vertices; ++vertex_3_id) {
+                if (adjacency_matrix[vertex_1_id][vertex_2_id]
+                        && adjacency_matrix[vertex_1_id][vertex_3_id]
+                        && adjacency_matrix[vertex_2_id][vertex_3_id]) {
+                    expected_number_of_triangles++;
+                    expected_vertices_number_of_triangles[vertex_1_id]++;
+                    expected_vertices_number_of_triangles[vertex_2_id]++;
+                    expected_vertices_number_of_triangles[vertex_3_id]++;
+                }
+            }
+        }
+    }
+    std::vector<Counter> expected_edges_number_of_triangles(graph.number_of_edges(), 0);
+    for (EdgeId edge_id = 0; edge_id < graph.number_of_edges(); ++edge_id) {
+        const AdjacencyListGraph::Edge& edge = graph.edge(edge_id);
+        for (VertexId vertex_id = 0; vertex_id < number_of_vertices; ++vertex_id) {
+            if (adjacency_matrix[edge.vertex_1_id][vertex_id]
+                    && adjacency_matrix[edge.vertex_2_id][vertex_id]) {
+                expected_edges_number_of_triangles[edge_id]++;
+            }
+        }
+    }
+
+    for (int number_of_threads: {1, 4}) {
+        TriangleCounts triangle_counts = count_triangles(graph, number_of_threads);
+        EXPECT_EQ(triangle_counts.number_of_triangles, expected_number_of_triangles);
+        EXPECT_EQ(triangle_counts.vertices_number_of_triangles, expected_vertices_number_of_triangles);
+        EXPECT_EQ(triangle_counts.edges_number_of_triangles, expected_edges_number_of_triangles);
+    }
+}
+
+TEST(Triangles, CountTrianglesParallelEdges)
+{
+    AdjacencyListGraphBuilder graph_builder;
+    for (VertexId vertex_id = 0; vertex_id < 4; ++vertex_id)
+        graph_builder.add_vertex();
+    graph_builder.add_edge(0, 1);
+    graph_builder.add_edge(1, 2);
+    graph_builder.add_edge(0, 2);
+    graph_builder.add_edge(2, 1);
+    graph_builder.add_edge(2, 3);
+    AdjacencyListGraph graph = graph_builder.build();
+
+    TriangleCounts triangle_counts = count_triangles(graph);
+    EXPECT_EQ(triangle_counts.number_of_triangles, 1);
+    EXPECT_EQ(triangle_counts.vertices_number_of_triangles, std::vector<Counter>({1, 1, 1, 0}));
+    EXPECT_EQ(triangle_counts.edges_number_of_triangles, std::vector<Counter>({1, 1, 1, 0, 0}));
+}